@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# ===--- run_compile_time.py ---------------------------------------------===//
+#
+#  This source file is part of the Swift.org open source project
+#
+#  Copyright (c) 2021 Apple Inc. and the Swift project authors
+#  Licensed under Apache License v2.0 with Runtime Library Exception
+#
+#  See https://swift.org/LICENSE.txt for license information
+#  See https://swift.org/CONTRIBUTORS.txt for the list of Swift authors
+#
+# ===---------------------------------------------------------------------===//
+"""Compile the corpus in sources/ with a just-built swiftc and compare
+per-phase wall times from UnifiedStatsReporter output against a recorded
+baseline. See README.md in this directory."""
+
+import argparse
+import glob
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PHASE_PREFIX = "time.swift."
+TOTAL_PREFIX = "time.swift-frontend."
+WALL_SUFFIX = ".wall"
+
+
+def extract_phase_times(stats_dir):
+    """Collect {phase: wall seconds} from every stats JSON in stats_dir."""
+    phases = {}
+    for path in glob.glob(os.path.join(stats_dir, "*.json")):
+        with open(path) as f:
+            stats = json.load(f)
+        for key, value in stats.items():
+            if not key.endswith(WALL_SUFFIX):
+                continue
+            if key.startswith(PHASE_PREFIX):
+                phase = key[len(PHASE_PREFIX):-len(WALL_SUFFIX)]
+            elif key.startswith(TOTAL_PREFIX):
+                phase = "total"
+            else:
+                continue
+            phases[phase] = phases.get(phase, 0.0) + value
+    return phases
+
+
+def measure(swiftc, source, extra_args, iterations):
+    """Compile source `iterations` times; return the per-phase minimum."""
+    best = {}
+    for _ in range(iterations):
+        tmpdir = tempfile.mkdtemp(prefix="swift-compile-time-")
+        stats_dir = os.path.join(tmpdir, "stats")
+        os.mkdir(stats_dir)
+        try:
+            cmd = [
+                swiftc, "-c", source,
+                "-o", os.path.join(tmpdir, "out.o"),
+                "-stats-output-dir", stats_dir,
+            ] + extra_args
+            subprocess.check_call(cmd)
+            for phase, value in extract_phase_times(stats_dir).items():
+                if phase not in best or value < best[phase]:
+                    best[phase] = value
+        finally:
+            shutil.rmtree(tmpdir)
+    return best
+
+
+def compare(name, measured, baseline, threshold, min_delta):
+    """Print regressions for one source; return their count."""
+    regressions = 0
+    for phase, base in sorted(baseline.items()):
+        value = measured.get(phase)
+        if value is None:
+            continue
+        if value > base * (1.0 + threshold) and value - base > min_delta:
+            print("REGRESSION %s/%s: %.4fs -> %.4fs (+%.1f%%)" %
+                  (name, phase, base, value, 100.0 * (value - base) / base))
+            regressions += 1
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--swiftc", required=True,
+                        help="path to the just-built swiftc")
+    parser.add_argument("--baseline", required=True,
+                        help="baseline JSON file to compare against or update")
+    parser.add_argument("--sources",
+                        default=os.path.join(os.path.dirname(__file__),
+                                             "sources"),
+                        help="directory of corpus .swift files")
+    parser.add_argument("--iterations", type=int, default=3,
+                        help="compiles per source; the minimum is used")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative regression threshold (0.10 = 10%%)")
+    parser.add_argument("--min-delta", type=float, default=0.01,
+                        help="absolute seconds a phase must regress by")
+    parser.add_argument("--update", action="store_true",
+                        help="record measurements as the new baseline")
+    parser.add_argument("extra_args", nargs="*",
+                        help="extra arguments passed through to swiftc")
+    args = parser.parse_args()
+
+    sources = sorted(glob.glob(os.path.join(args.sources, "*.swift")))
+    if not sources:
+        parser.error("no .swift files under " + args.sources)
+
+    results = {}
+    for source in sources:
+        name = os.path.splitext(os.path.basename(source))[0]
+        results[name] = measure(args.swiftc, source, args.extra_args,
+                                args.iterations)
+        print("%s: total %.4fs over %d phases" %
+              (name, results[name].get("total", 0.0), len(results[name])))
+
+    if args.update:
+        with open(args.baseline, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("baseline written to " + args.baseline)
+        return 0
+
+    if not os.path.exists(args.baseline):
+        print("error: no baseline at %s; run with --update to record one" %
+              args.baseline)
+        return 1
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    regressions = 0
+    for name, measured in sorted(results.items()):
+        regressions += compare(name, measured, baseline.get(name, {}),
+                               args.threshold, args.min_delta)
+
+    if regressions:
+        print("%d phase(s) regressed" % regressions)
+        return 1
+    print("no compile-time regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
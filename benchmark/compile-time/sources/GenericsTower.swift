@@ -0,0 +1,72 @@
+// Generic-signature and requirement-machine stressor: associated-type
+// chains, conditional conformances, and deeply nested generic types.
+
+protocol Layer {
+  associatedtype Wrapped
+  var wrapped: Wrapped { get }
+}
+
+struct Base: Layer {
+  typealias Wrapped = Int
+  var wrapped: Int { 0 }
+}
+
+struct Wrap<T: Layer>: Layer {
+  typealias Wrapped = T
+  var inner: T
+  var wrapped: T { inner }
+}
+
+extension Wrap: Equatable where T: Equatable {
+  static func == (lhs: Wrap, rhs: Wrap) -> Bool { lhs.inner == rhs.inner }
+}
+extension Base: Equatable {}
+
+typealias Tower2 = Wrap<Wrap<Base>>
+typealias Tower4 = Wrap<Wrap<Tower2>>
+typealias Tower8 = Wrap<Wrap<Wrap<Wrap<Tower4>>>>
+
+func peel<T: Layer>(_ value: T) -> T.Wrapped { value.wrapped }
+
+func peelTwice<T: Layer>(_ value: T) -> T.Wrapped.Wrapped
+    where T.Wrapped: Layer {
+  value.wrapped.wrapped
+}
+
+func peelThrice<T: Layer>(_ value: T) -> T.Wrapped.Wrapped.Wrapped
+    where T.Wrapped: Layer, T.Wrapped.Wrapped: Layer {
+  value.wrapped.wrapped.wrapped
+}
+
+protocol Combining {
+  associatedtype Element
+  static func combine(_ lhs: Element, _ rhs: Element) -> Element
+}
+
+struct AddInts: Combining {
+  static func combine(_ lhs: Int, _ rhs: Int) -> Int { lhs + rhs }
+}
+
+struct Pairwise<A: Combining, B: Combining>: Combining {
+  typealias Element = (A.Element, B.Element)
+  static func combine(_ lhs: Element, _ rhs: Element) -> Element {
+    (A.combine(lhs.0, rhs.0), B.combine(lhs.1, rhs.1))
+  }
+}
+
+typealias Quad = Pairwise<Pairwise<AddInts, AddInts>,
+                          Pairwise<AddInts, AddInts>>
+
+func fold<C: Combining>(_: C.Type, _ values: [C.Element]) -> C.Element? {
+  guard var result = values.first else { return nil }
+  for v in values.dropFirst() {
+    result = C.combine(result, v)
+  }
+  return result
+}
+
+func exerciseTower() -> Int {
+  let tower = Wrap(inner: Wrap(inner: Wrap(inner: Wrap(inner: Base()))))
+  let sum = fold(Quad.self, [((1, 2), (3, 4)), ((5, 6), (7, 8))])
+  return peelThrice(tower).wrapped + (sum?.0.0 ?? 0)
+}
@@ -0,0 +1,299 @@
+// Enum-layout and exhaustiveness stressor: a wide enum with mixed
+// payloads and an exhaustive switch, which exercises spare-bit and
+// switch-coverage computation in Sema, SILGen, and IRGen.
+
+enum Opcode {
+  case op000
+  case op001
+  case op002
+  case op003
+  case op004
+  case op005
+  case op006
+  case op007
+  case op008
+  case op009
+  case op010
+  case op011
+  case op012
+  case op013
+  case op014
+  case op015
+  case op016
+  case op017
+  case op018
+  case op019
+  case op020
+  case op021
+  case op022
+  case op023
+  case op024
+  case op025
+  case op026
+  case op027
+  case op028
+  case op029
+  case op030
+  case op031
+  case op032
+  case op033
+  case op034
+  case op035
+  case op036
+  case op037
+  case op038
+  case op039
+  case op040
+  case op041
+  case op042
+  case op043
+  case op044
+  case op045
+  case op046
+  case op047
+  case op048
+  case op049
+  case op050
+  case op051
+  case op052
+  case op053
+  case op054
+  case op055
+  case op056
+  case op057
+  case op058
+  case op059
+  case op060
+  case op061
+  case op062
+  case op063
+  case op064
+  case op065
+  case op066
+  case op067
+  case op068
+  case op069
+  case op070
+  case op071
+  case op072
+  case op073
+  case op074
+  case op075
+  case op076
+  case op077
+  case op078
+  case op079
+  case op080
+  case op081
+  case op082
+  case op083
+  case op084
+  case op085
+  case op086
+  case op087
+  case op088
+  case op089
+  case op090
+  case op091
+  case op092
+  case op093
+  case op094
+  case op095
+  case op096
+  case op097
+  case op098
+  case op099
+  case load0(offset: Int)
+  case load1(offset: Int)
+  case load2(offset: Int)
+  case load3(offset: Int)
+  case load4(offset: Int)
+  case load5(offset: Int)
+  case load6(offset: Int)
+  case load7(offset: Int)
+  case load8(offset: Int)
+  case load9(offset: Int)
+  case load10(offset: Int)
+  case load11(offset: Int)
+  case load12(offset: Int)
+  case load13(offset: Int)
+  case load14(offset: Int)
+  case load15(offset: Int)
+  case load16(offset: Int)
+  case load17(offset: Int)
+  case load18(offset: Int)
+  case load19(offset: Int)
+  case store0(offset: Int, value: Double)
+  case store1(offset: Int, value: Double)
+  case store2(offset: Int, value: Double)
+  case store3(offset: Int, value: Double)
+  case store4(offset: Int, value: Double)
+  case store5(offset: Int, value: Double)
+  case store6(offset: Int, value: Double)
+  case store7(offset: Int, value: Double)
+  case store8(offset: Int, value: Double)
+  case store9(offset: Int, value: Double)
+  case store10(offset: Int, value: Double)
+  case store11(offset: Int, value: Double)
+  case store12(offset: Int, value: Double)
+  case store13(offset: Int, value: Double)
+  case store14(offset: Int, value: Double)
+  case store15(offset: Int, value: Double)
+  case store16(offset: Int, value: Double)
+  case store17(offset: Int, value: Double)
+  case store18(offset: Int, value: Double)
+  case store19(offset: Int, value: Double)
+  case branch(target: String)
+  case call(target: String, args: [Int])
+}
+
+func cost(_ op: Opcode) -> Int {
+  switch op {
+  case .op000: return 1
+  case .op001: return 2
+  case .op002: return 3
+  case .op003: return 4
+  case .op004: return 5
+  case .op005: return 6
+  case .op006: return 7
+  case .op007: return 1
+  case .op008: return 2
+  case .op009: return 3
+  case .op010: return 4
+  case .op011: return 5
+  case .op012: return 6
+  case .op013: return 7
+  case .op014: return 1
+  case .op015: return 2
+  case .op016: return 3
+  case .op017: return 4
+  case .op018: return 5
+  case .op019: return 6
+  case .op020: return 7
+  case .op021: return 1
+  case .op022: return 2
+  case .op023: return 3
+  case .op024: return 4
+  case .op025: return 5
+  case .op026: return 6
+  case .op027: return 7
+  case .op028: return 1
+  case .op029: return 2
+  case .op030: return 3
+  case .op031: return 4
+  case .op032: return 5
+  case .op033: return 6
+  case .op034: return 7
+  case .op035: return 1
+  case .op036: return 2
+  case .op037: return 3
+  case .op038: return 4
+  case .op039: return 5
+  case .op040: return 6
+  case .op041: return 7
+  case .op042: return 1
+  case .op043: return 2
+  case .op044: return 3
+  case .op045: return 4
+  case .op046: return 5
+  case .op047: return 6
+  case .op048: return 7
+  case .op049: return 1
+  case .op050: return 2
+  case .op051: return 3
+  case .op052: return 4
+  case .op053: return 5
+  case .op054: return 6
+  case .op055: return 7
+  case .op056: return 1
+  case .op057: return 2
+  case .op058: return 3
+  case .op059: return 4
+  case .op060: return 5
+  case .op061: return 6
+  case .op062: return 7
+  case .op063: return 1
+  case .op064: return 2
+  case .op065: return 3
+  case .op066: return 4
+  case .op067: return 5
+  case .op068: return 6
+  case .op069: return 7
+  case .op070: return 1
+  case .op071: return 2
+  case .op072: return 3
+  case .op073: return 4
+  case .op074: return 5
+  case .op075: return 6
+  case .op076: return 7
+  case .op077: return 1
+  case .op078: return 2
+  case .op079: return 3
+  case .op080: return 4
+  case .op081: return 5
+  case .op082: return 6
+  case .op083: return 7
+  case .op084: return 1
+  case .op085: return 2
+  case .op086: return 3
+  case .op087: return 4
+  case .op088: return 5
+  case .op089: return 6
+  case .op090: return 7
+  case .op091: return 1
+  case .op092: return 2
+  case .op093: return 3
+  case .op094: return 4
+  case .op095: return 5
+  case .op096: return 6
+  case .op097: return 7
+  case .op098: return 1
+  case .op099: return 2
+  case .load0(let offset): return offset % 5 + 0
+  case .load1(let offset): return offset % 5 + 1
+  case .load2(let offset): return offset % 5 + 2
+  case .load3(let offset): return offset % 5 + 3
+  case .load4(let offset): return offset % 5 + 4
+  case .load5(let offset): return offset % 5 + 5
+  case .load6(let offset): return offset % 5 + 6
+  case .load7(let offset): return offset % 5 + 7
+  case .load8(let offset): return offset % 5 + 8
+  case .load9(let offset): return offset % 5 + 9
+  case .load10(let offset): return offset % 5 + 10
+  case .load11(let offset): return offset % 5 + 11
+  case .load12(let offset): return offset % 5 + 12
+  case .load13(let offset): return offset % 5 + 13
+  case .load14(let offset): return offset % 5 + 14
+  case .load15(let offset): return offset % 5 + 15
+  case .load16(let offset): return offset % 5 + 16
+  case .load17(let offset): return offset % 5 + 17
+  case .load18(let offset): return offset % 5 + 18
+  case .load19(let offset): return offset % 5 + 19
+  case .store0(let offset, let value): return offset + Int(value) + 0
+  case .store1(let offset, let value): return offset + Int(value) + 1
+  case .store2(let offset, let value): return offset + Int(value) + 2
+  case .store3(let offset, let value): return offset + Int(value) + 3
+  case .store4(let offset, let value): return offset + Int(value) + 4
+  case .store5(let offset, let value): return offset + Int(value) + 5
+  case .store6(let offset, let value): return offset + Int(value) + 6
+  case .store7(let offset, let value): return offset + Int(value) + 7
+  case .store8(let offset, let value): return offset + Int(value) + 8
+  case .store9(let offset, let value): return offset + Int(value) + 9
+  case .store10(let offset, let value): return offset + Int(value) + 10
+  case .store11(let offset, let value): return offset + Int(value) + 11
+  case .store12(let offset, let value): return offset + Int(value) + 12
+  case .store13(let offset, let value): return offset + Int(value) + 13
+  case .store14(let offset, let value): return offset + Int(value) + 14
+  case .store15(let offset, let value): return offset + Int(value) + 15
+  case .store16(let offset, let value): return offset + Int(value) + 16
+  case .store17(let offset, let value): return offset + Int(value) + 17
+  case .store18(let offset, let value): return offset + Int(value) + 18
+  case .store19(let offset, let value): return offset + Int(value) + 19
+  case .branch(let target): return target.count
+  case .call(let target, let args): return target.count + args.count
+  }
+}
+
+func totalCost(_ ops: [Opcode]) -> Int {
+  ops.reduce(0) { $0 + cost($1) }
+}
@@ -0,0 +1,55 @@
+// Expression-checker stressor: long operator chains with mixed literal
+// types, closures needing inference, and overloaded operators. Each body
+// is sized to keep the whole file's typecheck in the low seconds.
+
+func mixedArithmetic1() -> Double {
+  let a = 1 + 2 * 3 - 4 / 2 + 5 * 6 - 7 + 8 * 9 - 10 + 11 * 12
+  let b = 0.5 + Double(a) * 1.5 - 2.25 + 3.75 * 0.125 - 4.5 + 6.0 * 0.25
+  let c = b + Double(1 + 2 + 3 + 4 + 5) * 0.1 - Double(a % 7) / 3.0
+  return a > 0 ? b + c : b - c
+}
+
+func mixedArithmetic2() -> Double {
+  let xs = [1.0, 2.5, 3.25, 4.125, 5.0625, 6.5, 7.75, 8.875, 9.0, 10.5]
+  let sum = xs.reduce(0) { $0 + $1 * 2 - 1 + 0.5 }
+  let scaled = xs.map { $0 * 3.5 + 2.25 - 1.125 }.filter { $0 > 4.0 }
+  return sum + scaled.reduce(0, +) - Double(xs.count) * 0.25
+}
+
+func tupleShuffles() -> Int {
+  let pairs = (1...20).map { ($0, $0 * 2, $0 * 3 - 1) }
+  let folded = pairs.reduce(0) { acc, t in acc + t.0 - t.1 + t.2 }
+  let nested = pairs.map { (a, b, c) in (a + b, b + c, c + a) }
+  return folded + nested.reduce(0) { $0 + $1.0 - $1.1 + $1.2 }
+}
+
+func stringInterpolationChains() -> String {
+  let n = 42
+  let d = 2.5
+  let s1 = "a\(n)b\(d)c\(n + 1)d\(d * 2)e\(n - 1)f\(d / 2)"
+  let s2 = s1 + "g\(n * 2)h" + "i\(d + 1.5)j" + String(n % 5)
+  return s2 + [s1, s2].joined(separator: "\(n):\(d)")
+}
+
+func closureInference() -> [Int] {
+  let f: (Int) -> Int = { $0 * 2 + 1 }
+  let g = { (x: Int) in f(x) + x / 2 - 1 }
+  let h = { g(f($0)) + f(g($0)) }
+  return (1...30).map(h).filter { $0 % 3 != 0 }.map { $0 - 1 }
+}
+
+func dictionaryLiterals() -> Int {
+  let table = [
+    "one": 1, "two": 2, "three": 3, "four": 4, "five": 5,
+    "six": 6, "seven": 7, "eight": 8, "nine": 9, "ten": 10,
+  ]
+  let doubled = table.mapValues { $0 * 2 }
+  return doubled.values.reduce(0, +) + table.count
+}
+
+func ternaryCascades(_ x: Int) -> Int {
+  let a = x > 10 ? (x > 20 ? x * 2 : x + 5) : (x > 5 ? x - 1 : x * 3)
+  let b = a % 2 == 0 ? a / 2 : a * 3 + 1
+  let c = b > a ? b - a : a - b
+  return c > 100 ? c % 100 : (c > 50 ? c - 25 : c + 25)
+}
@@ -0,0 +1,128 @@
+//===--- RuntimePrimitives.swift ------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Microbenchmarks pinning the C++ runtime's hot entry points: reference
+// counting on a shared object, the dynamic cast success/failure matrix,
+// generic metadata cache hits, and raw allocation across a size sweep.
+// These mostly measure the runtime's fast paths — that is the point, since
+// those paths are what every ARC operation and cast in compiled code pays.
+
+import TestsUtils
+
+public let RuntimePrimitives = [
+  BenchmarkInfo(
+    name: "RetainReleaseShared",
+    runFunction: run_RetainReleaseShared,
+    tags: [.validation, .runtime]),
+  BenchmarkInfo(
+    name: "DynamicCastMatrix",
+    runFunction: run_DynamicCastMatrix,
+    tags: [.validation, .runtime]),
+  BenchmarkInfo(
+    name: "GenericMetadataLookup",
+    runFunction: run_GenericMetadataLookup,
+    tags: [.validation, .runtime]),
+  BenchmarkInfo(
+    name: "RawAllocationSweep",
+    runFunction: run_RawAllocationSweep,
+    tags: [.validation, .runtime]),
+]
+
+// MARK: - Reference counting on a shared object
+
+final class SharedNode {
+  var value: Int
+  init(_ value: Int) { self.value = value }
+}
+
+@inline(never)
+public func run_RetainReleaseShared(_ N: Int) {
+  let shared = SharedNode(42)
+  var slots = [SharedNode](repeating: shared, count: 16)
+  var total = 0
+  for i in 0..<(N * 100_000) {
+    // Each store releases the old reference and retains the new one on an
+    // object whose refcount is always greater than one.
+    slots[i & 15] = shared
+    total &+= slots[(i &+ 1) & 15].value
+  }
+  CheckResults(total == N * 100_000 * 42)
+}
+
+// MARK: - Dynamic cast matrix
+
+protocol Marker {}
+class CastBase {}
+class CastMiddle: CastBase, Marker {}
+class CastLeaf: CastMiddle {}
+class CastOther: CastBase {}
+
+@inline(never)
+public func run_DynamicCastMatrix(_ N: Int) {
+  let objects: [CastBase] = [CastBase(), CastMiddle(), CastLeaf(), CastOther()]
+  var succeeded = 0
+  var failed = 0
+  for _ in 0..<(N * 10_000) {
+    for object in objects {
+      // Class downcasts, one level and two levels, succeeding and failing.
+      if object as? CastMiddle != nil { succeeded &+= 1 } else { failed &+= 1 }
+      if object as? CastLeaf != nil { succeeded &+= 1 } else { failed &+= 1 }
+      // Existential casts through a conformance lookup.
+      if object is Marker { succeeded &+= 1 } else { failed &+= 1 }
+    }
+  }
+  CheckResults(succeeded == N * 10_000 * 5)
+  CheckResults(failed == N * 10_000 * 7)
+}
+
+// MARK: - Generic metadata cache hits
+
+struct Pair<T, U> {
+  var first: T?
+  var second: U?
+}
+
+@inline(never)
+func nestedMetadata<T, U>(_: T.Type, _: U.Type) -> Any.Type {
+  // Each call fetches instantiated generic metadata from the runtime cache.
+  return Pair<Pair<T, U>, Pair<U, T>>.self
+}
+
+@inline(never)
+public func run_GenericMetadataLookup(_ N: Int) {
+  var distinct = Set<ObjectIdentifier>()
+  for _ in 0..<(N * 10_000) {
+    distinct.insert(ObjectIdentifier(nestedMetadata(Int.self, String.self)))
+    distinct.insert(ObjectIdentifier(nestedMetadata(String.self, Int.self)))
+    distinct.insert(ObjectIdentifier(nestedMetadata(Double.self, Int8.self)))
+    distinct.insert(ObjectIdentifier(nestedMetadata(Int.self, Int.self)))
+  }
+  CheckResults(distinct.count == 4)
+}
+
+// MARK: - Raw allocation size sweep
+
+@inline(never)
+public func run_RawAllocationSweep(_ N: Int) {
+  let sizes = [16, 64, 256, 1024, 4096]
+  var touched = 0
+  for _ in 0..<(N * 2_000) {
+    for size in sizes {
+      let buffer = UnsafeMutableRawPointer.allocate(
+        byteCount: size, alignment: 16)
+      buffer.storeBytes(of: UInt8(truncatingIfNeeded: size), as: UInt8.self)
+      touched &+= Int(buffer.load(as: UInt8.self))
+      buffer.deallocate()
+    }
+  }
+  blackHole(touched)
+}
@@ -156,6 +156,7 @@ import ReduceInto
 import RemoveWhere
 import ReversedCollections
 import RomanNumbers
+import RuntimePrimitives
 import SIMDRandomMask
 import SIMDReduceInteger
 import SequenceAlgos
@@ -354,6 +355,7 @@ registerBenchmark(ReduceInto)
 registerBenchmark(RemoveWhere)
 registerBenchmark(ReversedCollections)
 registerBenchmark(RomanNumbers)
+registerBenchmark(RuntimePrimitives)
 registerBenchmark(SIMDRandomMask)
 registerBenchmark(SIMDReduceInteger)
 registerBenchmark(SequenceAlgos)
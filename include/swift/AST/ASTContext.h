@@ -112,6 +112,10 @@ namespace swift {
   class EnumElementDecl;
   class ProtocolDecl;
   class RequirementMachine;
+
+  namespace rewriting {
+    class Term;
+  }
   class SubstitutableType;
   class SourceManager;
   class ValueDecl;
@@ -355,6 +359,16 @@ private:
   getAllocator(AllocationArena arena = AllocationArena::Permanent) const;
 
 public:
+  /// Take a bump-pointer allocator from the constraint solver's reuse
+  /// pool, or a fresh one if the pool is empty. A recycled allocator
+  /// still owns its initial slab, so small expressions can be solved
+  /// without going back to malloc.
+  llvm::BumpPtrAllocator takeSolverAllocator() const;
+
+  /// Reset \p allocator and, if the pool isn't full, park it for reuse
+  /// by a later constraint system.
+  void recycleSolverAllocator(llvm::BumpPtrAllocator &&allocator) const;
+
   /// Allocate - Allocate memory from the ASTContext bump pointer.
   void *Allocate(unsigned long bytes, unsigned alignment,
                  AllocationArena arena = AllocationArena::Permanent) const {
@@ -364,8 +378,12 @@ public:
     if (LangOpts.UseMalloc)
       return AlignedAlloc(bytes, alignment);
 
-    if (arena == AllocationArena::Permanent && Stats)
-      Stats->getFrontendCounters().NumASTBytesAllocated += bytes;
+    if (Stats) {
+      if (arena == AllocationArena::Permanent)
+        Stats->getFrontendCounters().NumASTBytesAllocated += bytes;
+      else
+        Stats->getFrontendCounters().NumSolverBytesAllocated += bytes;
+    }
     return getAllocator(arena).Allocate(bytes, alignment);
   }
 
@@ -1148,6 +1166,28 @@ public:
   RequirementMachine *getOrCreateRequirementMachine(
       CanGenericSignature sig);
 
+  /// Retrieve the memoized result of applying \p substitutions to \p type
+  /// with \p options, or a null type if it has not been computed before.
+  /// Only whole-map applications without a tentative-type-witness callback
+  /// are memoized.
+  Type getCachedSubstitution(Type type, SubstitutionMap substitutions,
+                             SubstOptions options) const;
+
+  /// Memoize the result of applying \p substitutions to \p type, so that
+  /// repeated applications of the same map become hash lookups. Entries
+  /// involving type variables live in the constraint solver arena and are
+  /// discarded with it.
+  void cacheSubstitution(Type type, SubstitutionMap substitutions,
+                         SubstOptions options, Type result) const;
+
+  /// Retrieve the cached slot for rewrite rules lowered from the given
+  /// protocol's requirement signature. These depend only on the protocol
+  /// itself, so they are shared by every requirement machine built in this
+  /// context. On first use \p isNew is set and the caller is expected to
+  /// populate the returned vector.
+  std::vector<std::pair<rewriting::Term, rewriting::Term>> &
+  getOrCreateRewriteRulesForProtocol(const ProtocolDecl *proto, bool &isNew);
+
   /// Retrieve a generic signature with a single unconstrained type parameter,
   /// like `<T>`.
   CanGenericSignature getSingleGenericParameterSignature() const;
@@ -6064,6 +6064,14 @@ public:
   /// Retrieve the source range of the function body.
   SourceRange getBodySourceRange() const;
 
+  /// Retrieve a fingerprint of the text of this function's body, if it
+  /// has one that was written in source.
+  ///
+  /// Like \c IterableDeclContext::getBodyFingerprint, this only covers the
+  /// tokens between the braces: two functions whose bodies hash equal may
+  /// still typecheck differently if declarations they reference changed.
+  Optional<Fingerprint> getBodyFingerprint() const;
+
   /// Keep current \c getBodySourceRange() as the "original" body source range
   /// iff the this method hasn't been called on this object. The current body
   /// source range must be in the same buffer as the location of the declaration
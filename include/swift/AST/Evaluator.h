@@ -29,6 +29,7 @@
 #include "llvm/ADT/SetVector.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include <array>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -192,16 +193,16 @@ class Evaluator {
   /// non-null.
   UnifiedStatsReporter *stats = nullptr;
 
-  /// A vector containing the abstract request functions that can compute
-  /// the result of a particular request within a given zone. The
-  /// \c uint8_t is the zone number of the request, and the array is
-  /// indexed by the index of the request type within that zone. Each
+  /// A table containing the abstract request functions that can compute
+  /// the result of a particular request within a given zone. The table
+  /// is indexed by the zone number of the request, and each zone's array
+  /// is indexed by the index of the request type within that zone. Each
   /// entry is a function pointer that will be reinterpret_cast'd to
   ///
   ///   RequestType::OutputType (*)(const RequestType &request,
   ///                               Evaluator &evaluator);
   /// and called to satisfy the request.
-  std::vector<std::pair<uint8_t, ArrayRef<AbstractRequestFunction *>>>
+  std::array<ArrayRef<AbstractRequestFunction *>, 256>
     requestFunctionsByZone;
 
   /// A vector containing all of the active evaluation requests, which
@@ -381,6 +382,7 @@ private:
   getResultCached(const Request &request) {
     // If there is a cached result, return it.
     if (auto cached = request.getCachedResult()) {
+      if (stats) ++stats->getFrontendCounters().NumEvaluatorCacheHits;
       recorder.replayCachedRequest(request);
       handleDependencySinkRequest<Request>(request, *cached);
       return *cached;
@@ -410,6 +412,7 @@ private:
     auto known = cache.find_as<Request>(request);
     if (known != cache.end<Request>()) {
       auto result = known->second;
+      if (stats) ++stats->getFrontendCounters().NumEvaluatorCacheHits;
       recorder.replayCachedRequest(request);
       handleDependencySinkRequest<Request>(request, result);
       return result;
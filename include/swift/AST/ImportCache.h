@@ -114,8 +114,20 @@ class alignas(ImportedModule) ImportCache {
                             const DeclContext *>,
                  ArrayRef<ImportPath::Access>> ShadowCache;
 
+  /// Memoized re-export lists of fully-loaded modules, used when walking
+  /// the transitive closure of an import set. Modules with source file
+  /// units are never cached here, since their imports can still change.
+  llvm::DenseMap<const ModuleDecl *, ArrayRef<ImportedModule>> ExportCache;
+
   ImportPath::Access EmptyAccessPath;
 
+  ArrayRef<ImportedModule>
+  getExportedModules(const ModuleDecl *mod,
+                     SmallVectorImpl<ImportedModule> &scratch);
+
+  void collectExports(ImportedModule next,
+                      SmallVectorImpl<ImportedModule> &stack);
+
   ArrayRef<ImportPath::Access> allocateArray(
       ASTContext &ctx,
       SmallVectorImpl<ImportPath::Access> &results);
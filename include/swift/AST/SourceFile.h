@@ -253,6 +253,26 @@ public:
   llvm::DenseMap<ValueDecl *, std::vector<DeclAttribute *>>
       AttrsAddedByAccessNotes;
 
+  /// For each operator name, the overload most recently selected for it
+  /// while applying a solution in this file. Files tend to use the same
+  /// operator overloads over and over, so the solver tries these first
+  /// when ordering disjunction choices for later expressions; see
+  /// \c DisjunctionChoiceProducer::partitionDisjunction().
+  llvm::DenseMap<Identifier, ValueDecl *> LastSolvedOperatorOverloads;
+
+  /// Key for \c PreCheckedOperatorLookups: operator name, innermost type
+  /// context of the use (which can contribute member operators), and the
+  /// DeclRefKind of the reference.
+  using OperatorLookupKey =
+      std::pair<std::pair<Identifier, const DeclContext *>, unsigned>;
+
+  /// Candidate sets produced by unqualified operator lookups while
+  /// pre-checking expressions in this file. Operators can only be declared
+  /// at module or type scope, so the result doesn't depend on the position
+  /// of the use; see \c resolveDeclRefExpr in PreCheckExpr.cpp.
+  llvm::DenseMap<OperatorLookupKey, std::vector<ValueDecl *>>
+      PreCheckedOperatorLookups;
+
   /// Describes what kind of file this is, which can affect some type checking
   /// and other behavior.
   const SourceFileKind Kind;
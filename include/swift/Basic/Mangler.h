@@ -50,6 +50,15 @@ protected:
   llvm::SmallVector<WordReplacement, 8> SubstWordsInIdent;
 
   /// Substitutions, except identifier substitutions.
+  ///
+  /// These tables are positional state of the current mangled string: a
+  /// substitution's index is the order in which its spelling first appeared
+  /// in this output, and the demangler reconstructs the table by replaying
+  /// that one string. They are cleared by beginMangling and cannot be
+  /// seeded from another mangling — indices carried over from a parent
+  /// context's symbol would reference spellings this string never emitted.
+  /// Reuse across clients therefore happens a level up, on whole symbol
+  /// names (e.g. IRGen caches them per LinkEntity), not on mangler state.
   llvm::DenseMap<const void *, unsigned> Substitutions;
 
   /// Identifier substitutions.
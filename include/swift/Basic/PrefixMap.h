@@ -51,6 +51,16 @@ template <class KeyElementType> class PrefixMapKeyPrinter;
 
 /// A map whose keys are sequences of comparable values, optimized for
 /// finding a mapped value for the longest matching initial subsequence.
+///
+/// Key fragments are already stored inline in the nodes: each node embeds
+/// up to InlineKeyCapacity elements directly (sized so a node stays
+/// pointer-aligned and small), and a lookup chases a Further link only
+/// after exhausting a node's inline fragment. With fragments capped at
+/// seven bytes there is no room for SIMD comparison to beat the scalar
+/// loop — the mismatch position is needed, not just equality, and the
+/// compare is over at most a word. Note also that PathRemapper
+/// deliberately does not use this structure; it keeps an ordered linear
+/// list to match Clang's prefix-replacement semantics exactly.
 template <class KeyElementType, class ValueType,
           size_t InlineKeyCapacity = std::max(
               (sizeof(void *) - 1) / sizeof(KeyElementType), size_t(1))>
@@ -231,6 +231,14 @@ public:
   /// If \p BufferID is provided, \p Loc must come from that source buffer.
   ///
   /// This respects \c #sourceLocation directives.
+  ///
+  /// Translation is not a per-query scan: llvm::SourceMgr lazily builds a
+  /// newline offset table per buffer on the first query (sized to the
+  /// buffer, down to one byte per line for small files) and binary-searches
+  /// it afterwards, so repeated queries cost O(log lines). Hot callers
+  /// that translate monotonically increasing locations — diagnostics and
+  /// index emission — benefit most from querying against the same buffer
+  /// so the table is built once.
   std::pair<unsigned, unsigned>
   getPresumedLineAndColumnForLoc(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
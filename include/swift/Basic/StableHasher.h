@@ -177,10 +177,23 @@ public:
     return combine_range(arg.begin(), arg.end());
   }
 
+  void combine(const std::string &arg) {
+    combine(static_cast<std::ptrdiff_t>(arg.size()));
+    combine_bytes(reinterpret_cast<const uint8_t *>(arg.data()), arg.size());
+  }
+
   void combine(llvm::StringRef arg) {
-    return combine_range(arg.begin(), arg.end());
+    combine(static_cast<std::ptrdiff_t>(arg.size()));
+    combine_bytes(reinterpret_cast<const uint8_t *>(arg.data()), arg.size());
   }
 
+  /// Feed a contiguous run of bytes into the hasher.
+  ///
+  /// This produces exactly the digest that combining each byte in order
+  /// would, but compresses whole 64-bit words straight from the input
+  /// instead of staging every byte through the inline buffer.
+  void combine_bytes(const uint8_t *bytes, uint64_t length);
+
   template <typename T,
             decltype(StableHasher::Combiner<T>::combine) * = nullptr>
   void combine(const T &val) {
@@ -344,6 +344,24 @@ class Demangler;
 /// Declaring the context out of the loop minimizes the amount of needed memory
 /// allocations.
 ///
+/// This loop is the intended "session" pattern for bulk demangling:
+/// clear() frees all node trees but recycles the largest allocated slab,
+/// and because each new slab is at least as large as all previous slabs
+/// combined, repeated demangle/clear cycles converge on a single warm slab
+/// and stop hitting malloc entirely. A batch entry point would do nothing
+/// more than run this loop internally while forcing all input names to be
+/// gathered up front.
+///
+/// Owns a Demangler and its node memory across demangling requests.
+///
+/// Symbolizer-style clients processing a stream of names should reuse one
+/// Context and call clear() between names: node memory is bump-allocated and
+/// clear() keeps the grown slabs, so steady-state demangling of typical
+/// symbols does no heap allocation beyond the output string. That — not a
+/// separate single-pass demangle-to-string path — is the supported fast
+/// path; a second implementation of the mangling grammar that bypassed node
+/// construction would inevitably drift from the tree demangler, which is the
+/// reference for a security-sensitive grammar.
 class Context {
   Demangler *D;
 
@@ -26,6 +26,16 @@ namespace dependencies {
 
 /// The high-level implementation of the dependency scanner that runs on
 /// an individual worker thread.
+///
+/// The tool is designed to be hosted as a long-lived service inside the
+/// build system's process (via libSwiftScan): the module cache persists
+/// across queries, so a warm rescan only pays for modules it has not seen.
+/// Deliberately, the tool itself never decides that the filesystem has
+/// changed — it has no portable way to watch files, and only the host
+/// knows the boundaries of a build session. Instead the host drives
+/// invalidation explicitly: \c resetCache when sources may have changed,
+/// and \c serializeCache / \c loadCache to carry warm state between
+/// build-system invocations.
 class DependencyScanningTool {
 public:
   /// Construct a dependency scanning tool.
@@ -36,6 +36,19 @@ makeCodeCompletionMemoryBuffer(const llvm::MemoryBuffer *origBuf,
                                llvm::StringRef bufferIdentifier);
 
 /// Manages \c CompilerInstance for completion like operations.
+///
+/// This is the supported form of instance reuse for request-per-edit
+/// tooling: keep one whole \c CompilerInstance — including its loaded
+/// stdlib/SDK modules and warm ClangImporter — and revalidate it against
+/// the invocation hash and dependency mtimes before each request,
+/// re-typechecking only the changed function body. A finer-grained design
+/// that snapshots a post-import ASTContext and forks copy-on-write
+/// per-request children is not possible with this AST: decls, types, and
+/// identifiers are arena-allocated and mutually entangled through bare
+/// pointers, so there is no boundary along which state could be copied or
+/// shared per-fork. Tools with needs beyond completion should follow the
+/// same pattern: reuse the whole instance while its inputs validate, and
+/// rebuild it when they don't.
 class CompletionInstance {
   struct Options {
     unsigned MaxASTReuseCount = 100;
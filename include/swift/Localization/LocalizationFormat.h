@@ -229,6 +229,7 @@ class SerializedLocalizationProducer final : public LocalizationProducer {
   using SerializedLocalizationTable =
       llvm::OnDiskIterableChainedHashTable<LocalizationReaderInfo>;
   using offset_type = LocalizationReaderInfo::offset_type;
+  std::string filePath;
   std::unique_ptr<llvm::MemoryBuffer> Buffer;
   std::unique_ptr<SerializedLocalizationTable> SerializedTable;
 
@@ -237,6 +238,11 @@ public:
       std::unique_ptr<llvm::MemoryBuffer> buffer,
       bool printDiagnosticNames = false);
 
+  /// Defers opening \p filePath until the first diagnostic actually needs a
+  /// localized message.
+  explicit SerializedLocalizationProducer(llvm::StringRef filePath,
+                                          bool printDiagnosticNames = false);
+
 protected:
   bool initializeImpl() override;
   llvm::StringRef getMessage(swift::DiagID id) const override;
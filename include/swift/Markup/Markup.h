@@ -29,6 +29,13 @@ namespace markup {
 class LineList;
 
 class MarkupContext final {
+  /// All markup nodes and their copied strings are bump-allocated here and
+  /// freed together when the context dies; nothing is malloc'd per node.
+  /// The arena is not reset between comments on purpose — callers hand out
+  /// the parsed DocComment trees (print-as-ObjC, completion briefs, IDE
+  /// conversion) with lifetimes tied to the context, so the way to bound
+  /// memory is to scope the MarkupContext itself to the batch of comments
+  /// being processed.
   llvm::BumpPtrAllocator Allocator;
 
 public:
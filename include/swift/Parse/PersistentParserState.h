@@ -50,7 +50,13 @@ public:
         PrevOffset(PrevOffset) {}
 };
 
-/// Parser state persistent across multiple parses.
+/// Parser state persistent across the multiple parser passes of a code
+/// completion invocation.
+///
+/// Note that this is no longer how parse results are shared within a single
+/// frontend job: \c ParseSourceFileRequest caches each file's top-level decl
+/// skeleton on the \c SourceFile, so type-checking several primaries in one
+/// batch-mode frontend parses each non-primary file only once.
 class PersistentParserState {
   std::unique_ptr<CodeCompletionDelayedDeclState> CodeCompletionDelayedDeclStat;
 
@@ -314,6 +314,17 @@ public:
 };
 
 /// This class owns the memory for all TypeInfo instances that it vends.
+///
+/// Lowering is memoized: TypeRefs are uniqued by the TypeRefBuilder, and
+/// the cache below keys on the uniqued pointer, so each distinct type is
+/// lowered once per converter no matter how many queries hit it. The cache
+/// cannot be shared across ReflectionContexts or persisted between
+/// sessions, though — the keys are pointers into this context's TypeRef
+/// arena, the values reference this converter's pool, and the results
+/// depend on an opaque external TypeInfoProvider that has no stable
+/// identity to key an on-disk entry by. A consumer that re-creates
+/// contexts per query (and thus re-lowers everything) should instead keep
+/// one context alive for the lifetime of the target.
 class TypeConverter {
   TypeRefBuilder &Builder;
   std::vector<std::unique_ptr<const TypeInfo>> Pool;
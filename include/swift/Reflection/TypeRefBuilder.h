@@ -269,6 +269,11 @@ private:
   /// Cache for field info lookups.
   std::unordered_map<std::string, RemoteRef<FieldDescriptor>> FieldTypeInfoCache;
 
+  /// The number of entries of ReflectionInfos that have already been
+  /// ingested into FieldTypeInfoCache, so that cache misses only scan
+  /// reflection infos added since the previous scan.
+  size_t FieldTypeInfoCacheScannedInfos = 0;
+
   TypeConverter TC;
   MetadataSourceBuilder MSB;
 
@@ -0,0 +1,132 @@
+//===--- CachingMemoryReader.h - Cached remote memory access ----*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares a MemoryReader decorator that reduces round trips to
+//  the underlying reader by fetching aligned pages and serving sub-reads
+//  from a local cache.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_CACHINGMEMORYREADER_H
+#define SWIFT_REMOTE_CACHINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace swift {
+namespace remote {
+
+/// A MemoryReader which wraps another reader and caches page-aligned
+/// chunks of the remote address space, so that the fine-grained reads
+/// issued during metadata traversal become local memcpys instead of
+/// per-read round trips to the debugger or host.
+///
+/// The cache assumes the remote address space does not change for the
+/// lifetime of the cache, which holds for core files and for a debuggee
+/// that is stopped. Clients inspecting a process that may resume must
+/// call flush() at every point the target could have run.
+class CachingMemoryReader : public MemoryReader {
+  /// The granularity of reads issued to the underlying reader. One page
+  /// comfortably covers a metadata record and its neighbors, which exhibit
+  /// high locality during type reconstruction.
+  static constexpr uint64_t PageSize = 0x1000;
+
+  std::shared_ptr<MemoryReader> Underlying;
+
+  /// Successfully fetched pages, keyed by their remote base address.
+  std::unordered_map<uint64_t, std::unique_ptr<uint8_t[]>> Pages;
+
+  /// Base addresses of pages the underlying reader could not produce in
+  /// full (typically pages straddling the end of a mapping). Reads touching
+  /// these fall through to the underlying reader at their original
+  /// granularity rather than being retried per query.
+  std::unordered_set<uint64_t> IncompletePages;
+
+  /// Return the cached contents of the page containing \p pageStart,
+  /// fetching it from the underlying reader if necessary, or null if the
+  /// page cannot be read in full.
+  const uint8_t *getPage(uint64_t pageStart) {
+    auto known = Pages.find(pageStart);
+    if (known != Pages.end())
+      return known->second.get();
+    if (IncompletePages.count(pageStart))
+      return nullptr;
+
+    auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[PageSize]);
+    if (!Underlying->readBytes(RemoteAddress(pageStart), buffer.get(),
+                               PageSize)) {
+      IncompletePages.insert(pageStart);
+      return nullptr;
+    }
+    auto *data = buffer.get();
+    Pages.emplace(pageStart, std::move(buffer));
+    return data;
+  }
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> underlying)
+      : Underlying(std::move(underlying)) {}
+
+  /// Discard all cached pages. Must be called whenever the remote process
+  /// may have run since the cache was populated.
+  void flush() {
+    Pages.clear();
+    IncompletePages.clear();
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Underlying->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Underlying->getSymbolAddress(name);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return Underlying->readString(address, dest);
+  }
+
+  RemoteAbsolutePointer resolvePointer(RemoteAddress address,
+                                       uint64_t readValue) override {
+    return Underlying->resolvePointer(address, readValue);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    uint64_t addr = address.getAddressData();
+    while (size > 0) {
+      uint64_t pageStart = addr & ~(PageSize - 1);
+      uint64_t offset = addr - pageStart;
+      uint64_t chunk = std::min(size, PageSize - offset);
+      if (const uint8_t *page = getPage(pageStart)) {
+        memcpy(dest, page + offset, chunk);
+      } else if (!Underlying->readBytes(RemoteAddress(addr), dest, chunk)) {
+        // The page is partially unreadable and so is the requested range.
+        return false;
+      }
+      dest += chunk;
+      addr += chunk;
+      size -= chunk;
+    }
+    return true;
+  }
+};
+
+} // namespace remote
+} // namespace swift
+
+#endif // SWIFT_REMOTE_CACHINGMEMORYREADER_H
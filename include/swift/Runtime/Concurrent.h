@@ -986,6 +986,48 @@ public:
     return ReaderCount.load(std::memory_order_relaxed) > 0;
   }
 
+  /// Pre-size the table so that at least \p likelyElementCount elements can
+  /// be inserted without growing either array. Useful for processes that are
+  /// known to populate a large table immediately at startup: reserving up
+  /// front avoids the repeated copy-and-defer-free cycles that incremental
+  /// growth performs while readers are active. Concurrent readers and
+  /// writers remain safe during the call; reserving less than the current
+  /// size is a no-op.
+  void reserve(size_t likelyElementCount) {
+    typename MutexTy::ScopedLock guard(WriterLock);
+
+    auto elementCount = ElementCount.load(std::memory_order_relaxed);
+    auto *elements = Elements.load(std::memory_order_relaxed);
+    if (!elements || elements->Capacity < likelyElementCount) {
+      auto *newElements = ElementStorage::allocate(likelyElementCount);
+      if (elements) {
+        memcpy(newElements->data(), elements->data(),
+               elementCount * sizeof(ElemTy));
+        ConcurrentFreeListNode::add(&FreeList, elements);
+      }
+      // See the comment in resize() for why this must be seq_cst.
+      Elements.store(newElements, std::memory_order_seq_cst);
+      elements = newElements;
+    }
+
+    // Double the indices until likelyElementCount elements stay below the
+    // occupancy threshold that getOrInsert() grows at.
+    auto indices = IndexStorage{Indices.load(std::memory_order_relaxed)};
+    auto *elementsPtr = elements ? elements->data() : nullptr;
+    while (true) {
+      auto indicesCapacityLog2 = indices.getCapacityLog2();
+      auto indicesCapacity = 1UL << indicesCapacityLog2;
+      if (likelyElementCount + 1 < indicesCapacity) {
+        auto emptyCount = indicesCapacity - (likelyElementCount + 1);
+        if (indicesCapacity / emptyCount < ResizeProportion)
+          break;
+      }
+      indices = resize(indices, indicesCapacityLog2, elementsPtr);
+    }
+
+    deallocateFreeListIfSafe();
+  }
+
   /// Readers take a snapshot of the hash map, then work with the snapshot.
   class Snapshot {
     ConcurrentReadableHashMap *Map;
@@ -31,6 +31,14 @@ typedef bool swift_once_t;
 // On OS X and iOS, swift_once_t matches dispatch_once_t.
 typedef long swift_once_t;
 
+#elif defined(__linux__)
+
+// On Linux, swift_once is implemented by the runtime itself so that the
+// predicate has a known "done" value (-1) that the compiler can test with
+// an inline load before calling into the runtime. See
+// SwiftTargetInfo.OnceDonePredicateValue.
+typedef intptr_t swift_once_t;
+
 #elif defined(__CYGWIN__)
 
 // On Cygwin, std::once_flag can not be used because it is larger than the
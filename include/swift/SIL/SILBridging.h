@@ -9,6 +9,19 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Performance notes for pass authors: everything here bridges by reference,
+// never by copy. Data that is contiguous on the C++ side (an instruction's
+// operand list, a bridged value array) is exposed as a pointer + count so the
+// Swift side indexes it directly. Instructions and basic blocks are
+// individually allocated nodes of intrusive linked lists and are referenced by
+// pointer throughout the optimizer, so there is no contiguous array of them to
+// expose; traversal goes through _next/_previous calls, each of which is a
+// trivial C thunk with no marshalling. Bulk memory for pass-local data
+// structures is available through the BridgedSlab allocator functions rather
+// than per-element bridging calls.
+//
+//===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_SIL_SILBRIDGING_H
 #define SWIFT_SIL_SILBRIDGING_H
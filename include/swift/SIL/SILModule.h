@@ -854,7 +854,15 @@ public:
     return {result.data(), result.size()};
   }
 
-  /// Allocate memory for an instruction using the module's internal allocator.
+  /// Allocate memory for an instruction.
+  ///
+  /// Unlike most other SIL entities, instructions are not bump-allocated:
+  /// they are malloc'ed individually so that flushDeletedInsts() can return
+  /// the memory of deleted instructions to the system after every pass. This
+  /// is what keeps memory bounded over long pipelines on large functions.
+  /// Compacting live instructions into fresh storage instead would not be
+  /// possible anyway, since instructions are referenced by pointer throughout
+  /// the optimizer and its analyses.
   void *allocateInst(unsigned Size, unsigned Align) const;
 
   /// Called before \p I is removed from its basic block and scheduled for
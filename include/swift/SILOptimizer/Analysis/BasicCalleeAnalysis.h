@@ -125,6 +125,16 @@ private:
   CalleeList getCalleeListForCalleeKind(SILValue Callee) const;
 };
 
+/// Computes the set of possible targets of class-method and witness-method
+/// call sites.
+///
+/// The underlying CalleeCache is derived purely from the module's vtables and
+/// witness tables, never from the contents of function bodies. Changes to a
+/// function's instructions therefore cannot invalidate it, which is why the
+/// per-function invalidation hooks below are no-ops, and a full recomputation
+/// is only triggered when the method tables themselves change
+/// (invalidateFunctionTables). Late interprocedural passes thus do not pay a
+/// module-wide rebuild for ordinary function invalidations.
 class BasicCalleeAnalysis : public SILAnalysis {
   SILModule &M;
   std::unique_ptr<CalleeCache> Cache;
@@ -20,6 +20,18 @@
 /// Serrano, V. C. Sreedhar, and S. Midkiff
 /// http://dx.doi.org/10.1145/320384.320386
 ///
+/// The analysis is incremental: each function keeps a condensed summary graph
+/// in addition to its full connection graph, and when a function is
+/// invalidated only that function and its (transitive) callers are recomputed.
+/// A caller is only revisited further if merging a callee's summary actually
+/// changed its graph. Summaries exist purely in memory; they cannot be
+/// serialized into the swiftmodule because connection graph nodes are keyed by
+/// SILValue identity, which has no stable cross-invocation encoding. Calls
+/// into functions with no available SIL are therefore treated conservatively,
+/// as if all arguments escape globally. Callees whose SIL does get
+/// deserialized (e.g. @inlinable functions) are analyzed precisely like local
+/// functions.
+///
 /// This design is customized for SIL and the Swift memory model as follows:
 ///
 /// Each SILValue holding a memory address or object reference is mapped to a
@@ -1061,6 +1061,17 @@ private:
   void propagateLivenessDownNonLocalSuccessorEdges(LoopRegion *Parent);
 };
 
+/// Invalidation here is coarse by necessity, not by laziness: the pass
+/// manager's invalidation protocol broadcasts a kind (e.g. "branches
+/// changed"), never the individual CFG edits, so there is nothing to
+/// apply a localized tree patch from. The region tree is also derived
+/// from loop info and the post-order, which are themselves rebuilt
+/// wholesale under the same protocol — an incrementally patched tree
+/// over freshly recomputed inputs would be no cheaper. What keeps the
+/// cost bounded in practice is that FunctionAnalysisBase drops the info
+/// on invalidation but only reconstructs it on the next get(), so a
+/// transform that invalidates branches repeatedly pays for one rebuild
+/// per querying pass, not one per invalidation.
 class LoopRegionAnalysis : public FunctionAnalysisBase<LoopRegionFunctionInfo> {
   SILLoopAnalysis *SLA;
   PostOrderAnalysis *POA;
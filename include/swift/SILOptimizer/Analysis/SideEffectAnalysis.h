@@ -38,6 +38,16 @@ enum class RetainObserveKind {
 /// "effects" by first computing local effects, then propagating those effects
 /// bottom-up through the call graph.
 ///
+/// Summaries live only as long as their pass manager. They are deliberately
+/// not carried from the mandatory into the performance pipeline (the SIL they
+/// describe is rewritten wholesale in between) and they are not serialized
+/// into the swiftmodule: a computed summary is only sound for the exact body
+/// it was derived from, which library evolution does not guarantee for
+/// functions in other resilience domains. The supported cross-module carriers
+/// for effect information are the @_effects attribute, handled in
+/// summarizeFunction() before any body is visited, and serialized SIL for
+/// @inlinable functions, which is analyzed like local code once deserialized.
+///
 /// FunctionEffects constraints:
 /// - void clear()
 /// - void setWorstEffects()
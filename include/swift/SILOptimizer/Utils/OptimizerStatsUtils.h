@@ -18,6 +18,10 @@ class SILModule;
 class SILTransform;
 class SILPassManager;
 
+/// Returns true if any of the sil-stats-* options requesting the collection
+/// of optimizer counters is enabled.
+bool areOptimizerStatsEnabled();
+
 /// Updates SILModule stats before executing the transform \p Transform.
 ///
 /// \param M SILModule to be processed
@@ -108,6 +108,17 @@ namespace swift {
 ///
 /// TODO: This can be made space-efficient if all clients can maintain a block
 /// numbering so liveness info can be represented as bitsets across the blocks.
+///
+/// Note: this deliberately remains a pass-owned utility rather than a
+/// PassManager-registered analysis. Which uses are "interesting" is a policy
+/// decision of each client, so two passes asking about the same value compute
+/// different liveness sets, and the result is invalidated by any instruction
+/// insertion or deletion in the live range. A shared cache would therefore
+/// need per-client keys and per-instruction invalidation, at which point
+/// recomputing from the (typically small) pruned use set is cheaper. Clients
+/// that process many values should instead reuse one liveness object and
+/// clear() it between values, as CanonicalizeOSSALifetime does, so the
+/// underlying hash table allocations stay warm.
 class PrunedLiveBlocks {
 public:
   /// Per-block liveness state computed during backward dataflow propagation.
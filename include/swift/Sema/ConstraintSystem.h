@@ -26,6 +26,7 @@
 #include "swift/AST/DiagnosticsSema.h"
 #include "swift/AST/NameLookup.h"
 #include "swift/AST/PropertyWrappers.h"
+#include "swift/AST/ProtocolConformanceRef.h"
 #include "swift/AST/Types.h"
 #include "swift/Basic/Debug.h"
 #include "swift/Basic/LLVM.h"
@@ -38,6 +39,7 @@
 #include "swift/Sema/CSFix.h"
 #include "swift/Sema/OverloadChoice.h"
 #include "swift/Sema/SolutionResult.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/PointerUnion.h"
 #include "llvm/ADT/STLExtras.h"
@@ -2108,8 +2110,24 @@ private:
 
   llvm::DenseMap<Expr *, std::pair<unsigned, Expr *>> ExprWeights;
 
+  /// Owns the solver's allocator and returns it to the ASTContext's reuse
+  /// pool when the constraint system is destroyed. This member must be
+  /// declared before \c Arena: tearing down the arena runs the destructors
+  /// of conformances that were allocated from this allocator, so the
+  /// allocator's slabs may only be recycled after the arena is gone.
+  struct SolverAllocatorGuard {
+    ASTContext &Context;
+    llvm::BumpPtrAllocator Allocator;
+
+    explicit SolverAllocatorGuard(ASTContext &ctx)
+        : Context(ctx), Allocator(ctx.takeSolverAllocator()) {}
+    ~SolverAllocatorGuard() {
+      Context.recycleSolverAllocator(std::move(Allocator));
+    }
+  } AllocatorGuard;
+
   /// Allocator used for all of the related constraint systems.
-  llvm::BumpPtrAllocator Allocator;
+  llvm::BumpPtrAllocator &Allocator;
 
   /// Arena used for memory management of constraint-checker-related
   /// allocations.
@@ -2266,7 +2284,26 @@ private:
   /// Cache of the effects any closures visited.
   llvm::SmallDenseMap<ClosureExpr *, FunctionType::ExtInfo, 4> closureEffectsCache;
 
+  /// A cache of conformance lookups performed while solving. The solver
+  /// frequently asks for the same (type, protocol) pair, e.g. once per
+  /// attempted disjunction choice, and module-level lookup is not free.
+  llvm::DenseMap<std::pair<TypeBase *, ProtocolDecl *>, ProtocolConformanceRef>
+      Conformances;
+
+  /// Matches of fully-concrete canonical type pairs that are known to
+  /// fail for a given (kind, flags) combination. Deep disjunction
+  /// exploration re-attempts the same concrete matches many times; see
+  /// \c matchTypes for why only failures can be remembered. The set never
+  /// needs invalidation because the keys contain no type variables.
+  llvm::DenseSet<std::pair<std::pair<TypeBase *, TypeBase *>, unsigned>>
+      FailedConcreteMatches;
+
 public:
+  /// Check whether \p type conforms to \p protocol in the module of the
+  /// current declaration context, caching the result for re-use within
+  /// this constraint system.
+  ProtocolConformanceRef lookupConformance(Type type, ProtocolDecl *protocol);
+
   /// A map from argument expressions to their applied property wrapper expressions.
   llvm::SmallMapVector<ASTNode, SmallVector<AppliedPropertyWrapper, 2>, 4> appliedPropertyWrappers;
 
@@ -4285,6 +4322,12 @@ public: // FIXME: public due to statics in CSSimplify.cpp
                              TypeMatchOptions flags,
                              ConstraintLocatorBuilder locator);
 
+  /// The uncached implementation of \c matchTypes. Call \c matchTypes
+  /// instead; it consults the failed-match cache first.
+  TypeMatchResult matchTypesImpl(Type type1, Type type2, ConstraintKind kind,
+                                 TypeMatchOptions flags,
+                                 ConstraintLocatorBuilder locator);
+
   TypeMatchResult getTypeMatchSuccess() {
     return TypeMatchResult::success(*this);
   }
@@ -31,6 +31,12 @@
 // node retains the syntax arena. Should a RawSyntaxNode A reference a node B
 // from a different arena, it automatically adds B's arena as a child arena of
 // A's arena, thereby keeping B's arena alive as long as A's arena is alive.
+//
+// This arena-level lifetime model replaced per-node reference counting on
+// RawSyntax: nodes carry no refcount of their own, so tree traversals do no
+// atomic retain/release traffic and nodes stay immutable (and shareable
+// between trees during incremental reuse) for free. Only the arenas
+// themselves are refcounted, at tree-root granularity.
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_SYNTAX_RAWSYNTAX_H
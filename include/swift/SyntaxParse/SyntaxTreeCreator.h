@@ -38,6 +38,12 @@ class SyntaxTreeCreator final : public SyntaxParseActions {
   unsigned BufferID;
   RC<syntax::SyntaxArena> Arena;
 
+  /// The start of the source buffer in \c SM from which tokens are being
+  /// recorded. Token locations are translated to buffer offsets by direct
+  /// pointer arithmetic against this, avoiding a \c SourceManager query for
+  /// every recorded token.
+  const char *SourceBufferStart;
+
   /// A string allocated in \c Arena that contains an exact copy of the source
   /// file for which this \c SyntaxTreeCreator creates a syntax tree. \c
   /// RawSyntax nodes can safely reference text inside this buffer since they
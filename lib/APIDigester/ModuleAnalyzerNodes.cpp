@@ -595,6 +595,15 @@ static StringRef getKeyContent(SDKContext &Ctx, KeyKind Kind) {
   llvm_unreachable("Unhandled KeyKind in switch.");
 }
 
+// Baselines deliberately stay JSON parsed into a full SDKNode tree. The
+// format is the tool's public interface — baselines are checked into
+// repositories, diffed in code review, and patched by hand, all of which
+// an offset-based binary encoding would forfeit. And a streaming
+// comparator could not replace the materialized trees: diffing matches
+// nodes by USR and printed name across arbitrary reordering, removals,
+// and moves between type and extension, which requires random access to
+// both trees at once. The strings below are interned in SDKContext's
+// buffer, so the tree itself is compact relative to the parsed text.
 SDKNode* SDKNode::constructSDKNode(SDKContext &Ctx,
                                    llvm::yaml::MappingNode *Node) {
   static auto GetScalarString = [&](llvm::yaml::Node *N) -> StringRef {
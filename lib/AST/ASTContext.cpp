@@ -42,6 +42,7 @@
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/AST/RawComment.h"
 #include "swift/AST/RequirementMachine.h"
+#include "swift/AST/RewriteSystem.h"
 #include "swift/AST/SILLayout.h"
 #include "swift/AST/SemanticAttrs.h"
 #include "swift/AST/SourceFile.h"
@@ -420,6 +421,13 @@ struct ASTContext::Implementation {
     llvm::DenseMap<GenericSignature, std::unique_ptr<RequirementMachine>>
       RequirementMachines;
 
+    /// Memoized applications of a substitution map to a type, keyed by
+    /// (type, map storage, substitution flags). Applications involving
+    /// type variables land in the constraint solver arena's copy of this
+    /// table and die with it.
+    llvm::DenseMap<std::pair<std::pair<TypeBase *, void *>, unsigned>, Type>
+      SubstitutionResults;
+
     /// The set of function types.
     llvm::FoldingSet<FunctionType> FunctionTypes;
 
@@ -503,6 +511,18 @@ struct ASTContext::Implementation {
   /// The current constraint solver arena, if any.
   std::unique_ptr<ConstraintSolverArena> CurrentConstraintSolverArena;
 
+  /// Allocators retired by previous constraint systems, kept around so
+  /// that the next constraint system starts out with a warm slab rather
+  /// than a round trip through malloc.
+  SmallVector<llvm::BumpPtrAllocator, 2> SolverAllocatorPool;
+
+  /// Rewrite rules lowered from protocol requirement signatures, shared by
+  /// all requirement machines. Protocols are permanent declarations, so
+  /// this cache is never arena-scoped.
+  llvm::DenseMap<const ProtocolDecl *,
+                 std::vector<std::pair<rewriting::Term, rewriting::Term>>>
+      RewriteRulesForProtocol;
+
   Arena &getArena(AllocationArena arena) {
     switch (arena) {
     case AllocationArena::Permanent:
@@ -665,6 +685,34 @@ llvm::BumpPtrAllocator &ASTContext::getAllocator(AllocationArena arena) const {
   llvm_unreachable("bad AllocationArena");
 }
 
+llvm::BumpPtrAllocator ASTContext::takeSolverAllocator() const {
+  auto &pool = getImpl().SolverAllocatorPool;
+  if (pool.empty())
+    return llvm::BumpPtrAllocator();
+
+  auto allocator = std::move(pool.back());
+  pool.pop_back();
+  if (Stats)
+    ++Stats->getFrontendCounters().NumSolverAllocatorsReused;
+  return allocator;
+}
+
+void ASTContext::recycleSolverAllocator(
+    llvm::BumpPtrAllocator &&allocator) const {
+  auto &pool = getImpl().SolverAllocatorPool;
+
+  // Constraint systems can be nested (e.g. while solving a sub-expression
+  // for diagnostics), but the pool only needs enough entries for the
+  // common case; surplus allocators just release their memory.
+  static const unsigned maxPooledAllocators = 2;
+  if (pool.size() >= maxPooledAllocators)
+    return;
+
+  // Drop everything but the initial slab before parking the allocator.
+  allocator.Reset();
+  pool.push_back(std::move(allocator));
+}
+
 ImportPath::Raw
 swift::detail::ImportPathBuilder_copyToImpl(ASTContext &ctx,
                                             ImportPath::Raw raw) {
@@ -1803,8 +1851,11 @@ GenericSignatureBuilder *ASTContext::getOrCreateGenericSignatureBuilder(
   auto &genericSignatureBuilders =
       getImpl().getArena(arena).GenericSignatureBuilders;
   auto known = genericSignatureBuilders.find(sig);
-  if (known != genericSignatureBuilders.end())
+  if (known != genericSignatureBuilders.end()) {
+    if (Stats)
+      ++Stats->getFrontendCounters().NumGenericSignatureBuilderCacheHits;
     return known->second.get();
+  }
 
   // Create a new generic signature builder with the given signature.
   auto builder = new GenericSignatureBuilder(*this);
@@ -1908,6 +1959,66 @@ RequirementMachine *ASTContext::getOrCreateRequirementMachine(
   return machine;
 }
 
+/// Compute the arena and table key for memoizing an application of
+/// \p substitutions to \p type. Any type variable involved, in the type or
+/// in a replacement, sends the entry to the constraint solver arena.
+static std::pair<AllocationArena,
+                 std::pair<std::pair<TypeBase *, void *>, unsigned>>
+getSubstitutionCacheKey(Type type, SubstitutionMap substitutions,
+                        SubstOptions options) {
+  auto arena = AllocationArena::Permanent;
+  if (type->hasTypeVariable()) {
+    arena = AllocationArena::ConstraintSolver;
+  } else {
+    for (auto replacement : substitutions.getReplacementTypes()) {
+      if (replacement && replacement->hasTypeVariable()) {
+        arena = AllocationArena::ConstraintSolver;
+        break;
+      }
+    }
+  }
+
+  auto key = std::make_pair(
+      std::make_pair(type.getPtr(),
+                     const_cast<void *>(substitutions.getOpaqueValue())),
+      unsigned(options.toRaw()));
+  return {arena, key};
+}
+
+Type ASTContext::getCachedSubstitution(Type type,
+                                       SubstitutionMap substitutions,
+                                       SubstOptions options) const {
+  auto arenaAndKey = getSubstitutionCacheKey(type, substitutions, options);
+  auto &results = getImpl().getArena(arenaAndKey.first).SubstitutionResults;
+  auto known = results.find(arenaAndKey.second);
+  if (known == results.end())
+    return Type();
+
+  if (Stats)
+    ++Stats->getFrontendCounters().NumSubstitutionCacheHits;
+  return known->second;
+}
+
+void ASTContext::cacheSubstitution(Type type, SubstitutionMap substitutions,
+                                   SubstOptions options, Type result) const {
+  if (!result)
+    return;
+
+  auto arenaAndKey = getSubstitutionCacheKey(type, substitutions, options);
+  auto &results = getImpl().getArena(arenaAndKey.first).SubstitutionResults;
+  results[arenaAndKey.second] = result;
+  if (Stats)
+    ++Stats->getFrontendCounters().NumSubstitutionsMemoized;
+}
+
+std::vector<std::pair<rewriting::Term, rewriting::Term>> &
+ASTContext::getOrCreateRewriteRulesForProtocol(const ProtocolDecl *proto,
+                                               bool &isNew) {
+  auto result = getImpl().RewriteRulesForProtocol.try_emplace(proto);
+  isNew = result.second;
+  return result.first->second;
+}
+
 Optional<llvm::TinyPtrVector<ValueDecl *>>
 OverriddenDeclsRequest::getCachedResult() const {
   auto decl = std::get<0>(getStorage());
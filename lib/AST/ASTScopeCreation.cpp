@@ -594,9 +594,13 @@ void ASTScopeImpl::addChild(ASTScopeImpl *child, ASTContext &ctx) {
   checkSourceRangeBeforeAddingChild(child, ctx);
 #endif
 
-  // If this is the first time we've added children, notify the ASTContext
-  // that there's a SmallVector that needs to be cleaned up.
-  if (storedChildren.empty())
+  // Only out-of-line child storage needs teardown; the inline buffer lives
+  // and dies with the scope node's arena memory, and the elements are plain
+  // pointers. Notify the ASTContext the first time this push is about to
+  // spill the vector to the heap. Most scopes have few children and never
+  // register a cleanup at all.
+  if (storedChildren.size() == storedChildren.capacity() &&
+      storedChildren.capacity() == Children().capacity())
     ctx.addDestructorCleanup(storedChildren);
 
   storedChildren.push_back(child);
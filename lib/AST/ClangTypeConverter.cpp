@@ -837,6 +837,17 @@ clang::QualType ClangTypeConverter::convert(Type type) {
     }
   }
 
+  // Sugar never affects the conversion: every visitor either desugars or
+  // converts component-wise through convert(). Redirect non-canonical types
+  // to the canonical type's entry so all spellings of a type share one
+  // memoized conversion (including memoized failures).
+  auto canType = type->getCanonicalType();
+  if (canType.getPointer() != type.getPointer()) {
+    clang::QualType result = convert(canType);
+    Cache.insert({type, result});
+    return result;
+  }
+
   // If that failed, convert the type, cache, and return.
   clang::QualType result = visit(type);
   Cache.insert({type, result});
@@ -24,6 +24,7 @@
 #include "swift/AST/NameLookup.h"
 #include "swift/AST/SourceFile.h"
 #include "swift/AST/ProtocolConformance.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/AST/ProtocolConformanceRef.h"
 #include "llvm/Support/SaveAndRestore.h"
 
@@ -942,16 +943,25 @@ bool ConformanceLookupTable::lookupConformance(
   // Update to record all explicit and inherited conformances.
   updateLookupTable(nominal, ConformanceStage::Inherited);
 
-  // Look for conformances to this protocol.
+  // Look for conformances to this protocol. Explicit and inherited entries
+  // often suffice, in which case the nominal's implied conformances stay
+  // unexpanded; track how often each case happens.
+  auto &ctx = nominal->getASTContext();
   auto known = Conformances.find(protocol);
   if (known == Conformances.end()) {
     // If we didn't find anything, expand implied conformances.
+    if (ctx.Stats)
+      ++ctx.Stats->getFrontendCounters()
+            .NumConformanceLookupsForcingImpliedExpansion;
     updateLookupTable(nominal, ConformanceStage::ExpandedImplied);
     known = Conformances.find(protocol);
 
     // We didn't find anything.
     if (known == Conformances.end())
       return false;
+  } else if (ctx.Stats) {
+    ++ctx.Stats->getFrontendCounters()
+          .NumConformanceLookupsBeforeImpliedExpansion;
   }
 
   // Resolve the conformances for this protocol.
@@ -7117,6 +7117,29 @@ SourceRange AbstractFunctionDecl::getBodySourceRange() const {
   llvm_unreachable("bad BodyKind");
 }
 
+Optional<Fingerprint> AbstractFunctionDecl::getBodyFingerprint() const {
+  // Only bodies written in a source file have stable text to fingerprint;
+  // synthesized and deserialized bodies don't, and implicit functions can
+  // borrow source ranges from the code that produced them.
+  if (isImplicit() || !getParentSourceFile())
+    return None;
+
+  auto range = getBodySourceRange();
+  if (range.isInvalid())
+    return None;
+
+  // Hash the text between the body's delimiters. The range ends at the
+  // start of the closing token, which for a brace body is always "}", so
+  // nothing that can change is left out.
+  auto &sourceMgr = getASTContext().SourceMgr;
+  auto text = sourceMgr.extractText(
+      CharSourceRange(sourceMgr, range.Start, range.End));
+
+  auto hasher = StableHasher::defaultHasher();
+  hasher.combine(text);
+  return Fingerprint{std::move(hasher)};
+}
+
 SourceRange AbstractFunctionDecl::getSignatureSourceRange() const {
   if (isImplicit())
     return SourceRange();
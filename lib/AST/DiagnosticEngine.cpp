@@ -1033,6 +1033,15 @@ static AccessLevel getBufferAccessLevel(const Decl *decl) {
 
 Optional<DiagnosticInfo>
 DiagnosticEngine::diagnosticInfoForDiagnostic(const Diagnostic &diagnostic) {
+  // All rendering is gated on this behavior check: a diagnostic that
+  // resolves to Ignore (e.g. a warning under -suppress-warnings) returns
+  // before any decl is pretty-printed and before any argument is formatted.
+  // Arguments stay in their semantic form (Type, Decl name, etc.) inside
+  // DiagnosticArgument until a consumer formats the message text, so the
+  // cost of stringifying types is only paid for diagnostics that are
+  // actually displayed. The one piece of eager work for deferred
+  // diagnostics is onTentativeDiagnosticFlush copying string arguments
+  // whose storage may not outlive the transaction.
   auto behavior = state.determineBehavior(diagnostic);
   if (behavior == DiagnosticBehavior::Ignore)
     return None;
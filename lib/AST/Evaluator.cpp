@@ -29,14 +29,9 @@ using namespace swift;
 
 AbstractRequestFunction *
 Evaluator::getAbstractRequestFunction(uint8_t zoneID, uint8_t requestID) const {
-  for (const auto &zone : requestFunctionsByZone) {
-    if (zone.first == zoneID) {
-      if (requestID < zone.second.size())
-        return zone.second[requestID];
-
-      return nullptr;
-    }
-  }
+  auto zoneFunctions = requestFunctionsByZone[zoneID];
+  if (requestID < zoneFunctions.size())
+    return zoneFunctions[requestID];
 
   return nullptr;
 }
@@ -45,13 +40,9 @@ void Evaluator::registerRequestFunctions(
                                Zone zone,
                                ArrayRef<AbstractRequestFunction *> functions) {
   uint8_t zoneID = static_cast<uint8_t>(zone);
-#ifndef NDEBUG
-  for (const auto &zone : requestFunctionsByZone) {
-    assert(zone.first != zoneID);
-  }
-#endif
-
-  requestFunctionsByZone.push_back({zoneID, functions});
+  assert(requestFunctionsByZone[zoneID].empty() &&
+         "zone request functions already registered");
+  requestFunctionsByZone[zoneID] = functions;
 }
 
 Evaluator::Evaluator(DiagnosticEngine &diags, const LangOptions &opts)
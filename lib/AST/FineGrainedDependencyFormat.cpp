@@ -151,6 +151,15 @@ static llvm::Optional<DeclAspect> getDeclAspect(unsigned declAspect) {
   return None;
 }
 
+// A note on the container choice: swiftdeps stays a bitstream rather than a
+// flat mmap-able array format because the graph is never consumed in place.
+// The driver immediately integrates each SourceFileDepGraph into its
+// ModuleDepGraph — interning keys, matching nodes across compilations, and
+// rewiring edges — so node objects have to be materialized regardless of
+// how they are encoded, and these files are per-source-file and small. The
+// same records are also embedded inside swiftmodule files (see
+// Purpose::ForSwiftModule below), which constrains the container to the
+// bitstream the rest of serialization uses.
 bool Deserializer::readFineGrainedDependencyGraph(SourceFileDepGraph &g,
                                                   Purpose purpose) {
   using namespace record_block;
@@ -21,6 +21,7 @@
 #include "swift/AST/FileUnit.h"
 #include "swift/AST/ImportCache.h"
 #include "swift/AST/Module.h"
+#include "swift/AST/SourceFile.h"
 
 using namespace swift;
 using namespace namelookup;
@@ -63,11 +64,32 @@ void ImportSet::Profile(
   }
 }
 
-static void collectExports(ImportedModule next,
-                           SmallVectorImpl<ImportedModule> &stack) {
+ArrayRef<ImportedModule>
+ImportCache::getExportedModules(const ModuleDecl *mod,
+                                SmallVectorImpl<ImportedModule> &scratch) {
+  auto found = ExportCache.find(mod);
+  if (found != ExportCache.end())
+    return found->second;
+
+  scratch.clear();
+  mod->getImportedModulesForLookup(scratch);
+
+  // Loaded modules have a fixed set of re-exports, so computing it once per
+  // context is enough. Modules still being parsed can gain imports after
+  // import resolution (main file and REPL parsing), so don't memoize them.
+  for (auto *file : mod->getFiles())
+    if (isa<SourceFile>(file))
+      return scratch;
+
+  ArrayRef<ImportedModule> result = mod->getASTContext().AllocateCopy(scratch);
+  ExportCache[mod] = result;
+  return result;
+}
+
+void ImportCache::collectExports(ImportedModule next,
+                                 SmallVectorImpl<ImportedModule> &stack) {
   SmallVector<ImportedModule, 4> exports;
-  next.importedModule->getImportedModulesForLookup(exports);
-  for (auto exported : exports) {
+  for (auto exported : getExportedModules(next.importedModule, exports)) {
     if (next.accessPath.empty())
       stack.push_back(exported);
     else if (exported.accessPath.empty()) {
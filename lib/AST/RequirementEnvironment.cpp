@@ -23,6 +23,7 @@
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/AST/TypeCheckRequests.h"
 #include "swift/AST/Types.h"
+#include "swift/Basic/Statistic.h"
 #include "llvm/ADT/Statistic.h"
 
 #define DEBUG_TYPE "Protocol conformance checking"
@@ -201,6 +202,8 @@ RequirementEnvironment::RequirementEnvironment(
   }
 
   ++NumRequirementEnvironments;
+  if (auto *stats = ctx.Stats)
+    ++stats->getFrontendCounters().NumRequirementEnvironmentsBuilt;
 
   // Next, add each of the requirements (mapped from the requirement's
   // interface types into the abstract type parameters).
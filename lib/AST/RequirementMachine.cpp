@@ -57,13 +57,28 @@ void RewriteSystemBuilder::addGenericSignature(CanGenericSignature sig) {
   Protocols.computeLinearOrder();
   Protocols.computeInheritedAssociatedTypes();
 
-  // Add rewrite rules for each protocol.
+  // Add rewrite rules for each protocol. The rules lowered from a protocol
+  // depend only on the protocol itself, so they are cached in the ASTContext
+  // and shared by every signature that transitively references the protocol.
+  // Skip the cache when debugging so that every rule is printed.
+  const bool useCache = !Context.LangOpts.DebugRequirementMachine;
   for (auto *proto : Protocols.Protocols) {
     if (Context.LangOpts.DebugRequirementMachine) {
       llvm::dbgs() << "protocol " << proto->getName() << " {\n";
     }
 
+    bool isNew = true;
+    std::vector<std::pair<Term, Term>> *cachedRules = nullptr;
+    if (useCache)
+      cachedRules = &Context.getOrCreateRewriteRulesForProtocol(proto, isNew);
+
+    if (!isNew) {
+      Rules.insert(Rules.end(), cachedRules->begin(), cachedRules->end());
+      continue;
+    }
+
     const auto &info = Protocols.getProtocolInfo(proto);
+    unsigned firstRule = Rules.size();
 
     for (auto *type : info.AssociatedTypes)
       addAssociatedType(type, proto);
@@ -78,6 +93,9 @@ void RewriteSystemBuilder::addGenericSignature(CanGenericSignature sig) {
     for (auto req : info.Requirements)
       addRequirement(req.getCanonical(), proto);
 
+    if (cachedRules)
+      cachedRules->assign(Rules.begin() + firstRule, Rules.end());
+
     if (Context.LangOpts.DebugRequirementMachine) {
       llvm::dbgs() << "}\n";
     }
@@ -4061,6 +4061,28 @@ static Type substType(Type derivedType,
 
 Type Type::subst(SubstitutionMap substitutions,
                  SubstOptions options) const {
+  // Identical (type, map, options) applications recur constantly during
+  // specialization and conformance checking, and results are uniqued, so
+  // memoize whole-map applications in the ASTContext. Tentative type
+  // witnesses depend on in-flight checker state and are not cacheable.
+  const bool worthCaching =
+      (*this)->hasArchetype() || (*this)->hasTypeParameter() ||
+      (options.contains(SubstFlags::SubstituteOpaqueArchetypes) &&
+       (*this)->hasOpaqueArchetype());
+  if (worthCaching && !substitutions.empty() &&
+      !options.getTentativeTypeWitness) {
+    ASTContext &ctx = (*this)->getASTContext();
+    if (auto cached = ctx.getCachedSubstitution(*this, substitutions, options))
+      return cached;
+
+    auto result = substType(*this,
+                            QuerySubstitutionMap{substitutions},
+                            LookUpConformanceInSubstitutionMap(substitutions),
+                            options);
+    ctx.cacheSubstitution(*this, substitutions, options, result);
+    return result;
+  }
+
   return substType(*this,
                    QuerySubstitutionMap{substitutions},
                    LookUpConformanceInSubstitutionMap(substitutions),
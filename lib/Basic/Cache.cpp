@@ -14,17 +14,32 @@
 #include "Darwin/Cache-Mac.cpp"
 #else
 
-//  This file implements a default caching implementation that never evicts
-//  its entries.
+//  This file implements the caching mechanism for non-Darwin platforms as a
+//  cost-budgeted LRU. Values are kept on a recency list and evicted from the
+//  cold end once the accumulated cost exceeds the budget, mirroring what
+//  libcache does for us under memory pressure on Darwin. A value that is
+//  still retained by a client (via getAndRetain/setAndRetain without a
+//  matching releaseValue) is never evicted or destroyed; its destruction is
+//  deferred until the last client reference is released.
+//
+//  The budget is read from the SWIFT_SYS_CACHE_COST_LIMIT environment
+//  variable (in cost units, which callers typically report as bytes). When
+//  it is unset there is no budget and, like Darwin without memory pressure,
+//  nothing is evicted. Setting SWIFT_SYS_CACHE_STATS prints per-cache
+//  hit/miss/eviction counts on destruction.
 
 #include "swift/Basic/Cache.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/Mutex.h"
+#include "llvm/Support/raw_ostream.h"
+#include <cstdlib>
 
 using namespace swift::sys;
 using llvm::StringRef;
 
 namespace {
+struct EntryTy;
+
 struct DefaultCacheKey {
   void *Key = nullptr;
   CacheImpl::CallBacks *CBs = nullptr;
@@ -33,12 +48,100 @@ struct DefaultCacheKey {
   DefaultCacheKey(void *Key, CacheImpl::CallBacks *CBs) : Key(Key), CBs(CBs) {}
 };
 
+/// A cache entry. Entries live in the key map and on the LRU list while
+/// their key is present, and linger in the value map as unlisted "zombies"
+/// after removal for as long as a client still holds a reference.
+struct EntryTy {
+  void *Key = nullptr;
+  void *Value = nullptr;
+  size_t Cost = 0;
+  /// Number of outstanding client references (from getAndRetain or
+  /// setAndRetain) not yet dropped with releaseValue.
+  unsigned ExternalRefs = 0;
+  /// True once the entry's key has been removed; the value is destroyed
+  /// when the last external reference goes away.
+  bool Removed = false;
+  EntryTy *Prev = nullptr;
+  EntryTy *Next = nullptr;
+};
+
 struct DefaultCache {
   llvm::sys::Mutex Mux;
   CacheImpl::CallBacks CBs;
-  llvm::DenseMap<DefaultCacheKey, void *> Entries;
+  std::string Name;
+  llvm::DenseMap<DefaultCacheKey, EntryTy *> EntriesByKey;
+  llvm::DenseMap<void *, EntryTy *> EntriesByValue;
+  /// Most-recently-used list; Head is hottest, Tail is the eviction end.
+  EntryTy *Head = nullptr;
+  EntryTy *Tail = nullptr;
+  size_t TotalCost = 0;
+  /// Cost budget; zero means unbudgeted.
+  size_t CostLimit = 0;
+  uint64_t Hits = 0;
+  uint64_t Misses = 0;
+  uint64_t Evictions = 0;
+
+  DefaultCache(StringRef Name, CacheImpl::CallBacks CBs)
+      : CBs(std::move(CBs)), Name(Name) {
+    if (const char *S = ::getenv("SWIFT_SYS_CACHE_COST_LIMIT"))
+      CostLimit = ::strtoull(S, nullptr, 10);
+  }
+
+  void unlink(EntryTy *Entry) {
+    (Entry->Prev ? Entry->Prev->Next : Head) = Entry->Next;
+    (Entry->Next ? Entry->Next->Prev : Tail) = Entry->Prev;
+    Entry->Prev = Entry->Next = nullptr;
+  }
+
+  void pushFront(EntryTy *Entry) {
+    Entry->Next = Head;
+    (Head ? Head->Prev : Tail) = Entry;
+    Head = Entry;
+  }
+
+  void moveToFront(EntryTy *Entry) {
+    if (Head != Entry) {
+      unlink(Entry);
+      pushFront(Entry);
+    }
+  }
+
+  /// Drop the last external reference bookkeeping for \p Entry if it became
+  /// both removed and unreferenced; destroys the value.
+  void destroyIfDead(EntryTy *Entry) {
+    if (Entry->ExternalRefs != 0 || !Entry->Removed)
+      return;
+    EntriesByValue.erase(Entry->Value);
+    CBs.valueReleaseCB(Entry->Value, nullptr);
+    delete Entry;
+  }
 
-  explicit DefaultCache(CacheImpl::CallBacks CBs) : CBs(std::move(CBs)) { }
+  /// Detach \p Entry from the key map and LRU list, destroying its key. The
+  /// value survives until the last external reference is released.
+  void removeEntry(EntryTy *Entry) {
+    EntriesByKey.erase(DefaultCacheKey(Entry->Key, &CBs));
+    unlink(Entry);
+    TotalCost -= Entry->Cost;
+    CBs.keyDestroyCB(Entry->Key, nullptr);
+    Entry->Key = nullptr;
+    Entry->Removed = true;
+    destroyIfDead(Entry);
+  }
+
+  /// Evict cold, unreferenced entries until the budget is met.
+  void evictToFit() {
+    if (!CostLimit)
+      return;
+    EntryTy *Entry = Tail;
+    while (Entry && TotalCost > CostLimit) {
+      EntryTy *Prev = Entry->Prev;
+      if (Entry->ExternalRefs == 0) {
+        ++Evictions;
+        removeEntry(Entry);
+      }
+      Entry = Prev;
+    }
+  }
 };
 } // end anonymous namespace
 
@@ -68,7 +171,7 @@ template<> struct DenseMapInfo<DefaultCacheKey> {
 } // namespace llvm
 
 CacheImpl::ImplTy CacheImpl::create(StringRef Name, const CallBacks &CBs) {
-  return new DefaultCache(CBs);
+  return new DefaultCache(Name, CBs);
 }
 
 void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
@@ -76,29 +179,64 @@ void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
   llvm::sys::ScopedLock L(DCache.Mux);
 
   DefaultCacheKey CKey(Key, &DCache.CBs);
-  auto Entry = DCache.Entries.find(CKey);
+  auto KnownKey = DCache.EntriesByKey.find(CKey);
 
-  // If there is no existing entry, retain the value and insert the entry.
-  if (Entry == DCache.Entries.end()) {
-    DCache.CBs.valueRetainCB(Value, nullptr);
-    DCache.Entries[CKey] = Value;
-    return;
-  }
+  if (KnownKey != DCache.EntriesByKey.end()) {
+    EntryTy *Entry = KnownKey->second;
+
+    // The original key and the new key are ==. Swap the new key into the
+    // entry and destroy the original key.
+    std::swap(Entry->Key, Key);
+    DCache.EntriesByKey.erase(KnownKey);
+    DCache.EntriesByKey[DefaultCacheKey(Entry->Key, &DCache.CBs)] = Entry;
+    DCache.CBs.keyDestroyCB(Key, nullptr);
 
-  // If there is an existing entry, the the original key and the new key are ==.
-  // Swap the new key into the map and destroy the original key.
-  std::swap(Entry->first.Key, Key);
-  DCache.CBs.keyDestroyCB(Key, nullptr);
+    // Replace the value, if necessary. The old value keeps living while
+    // clients still reference it.
+    if (Entry->Value != Value) {
+      DCache.EntriesByValue.erase(Entry->Value);
+      EntryTy *Zombie = new EntryTy();
+      Zombie->Value = Entry->Value;
+      Zombie->ExternalRefs = Entry->ExternalRefs;
+      Zombie->Removed = true;
+      if (Zombie->ExternalRefs == 0) {
+        DCache.CBs.valueReleaseCB(Zombie->Value, nullptr);
+        delete Zombie;
+      } else {
+        DCache.EntriesByValue[Zombie->Value] = Zombie;
+      }
 
-  // Replace the value, if necessary.
-  if (Entry->second != Value) {
-    DCache.CBs.valueRetainCB(Value, nullptr);
-    std::swap(Entry->second, Value);
-    DCache.CBs.valueReleaseCB(Value, nullptr);
+      DCache.CBs.valueRetainCB(Value, nullptr);
+      Entry->Value = Value;
+      Entry->ExternalRefs = 0;
+      assert(!DCache.EntriesByValue.count(Value) &&
+             "value must not be cached under multiple keys");
+      DCache.EntriesByValue[Value] = Entry;
+    }
+
+    DCache.TotalCost += Cost - Entry->Cost;
+    Entry->Cost = Cost;
+    ++Entry->ExternalRefs;
+    DCache.moveToFront(Entry);
+    DCache.evictToFit();
+    return;
   }
 
-  // FIXME: Not thread-safe! It should avoid deleting the value until
-  // 'releaseValue is called on it.
+  // No existing entry; retain the value and insert a fresh one, already
+  // holding the caller's reference.
+  EntryTy *Entry = new EntryTy();
+  Entry->Key = Key;
+  Entry->Value = Value;
+  Entry->Cost = Cost;
+  Entry->ExternalRefs = 1;
+  DCache.CBs.valueRetainCB(Value, nullptr);
+  DCache.EntriesByKey[DefaultCacheKey(Key, &DCache.CBs)] = Entry;
+  assert(!DCache.EntriesByValue.count(Value) &&
+         "value must not be cached under multiple keys");
+  DCache.EntriesByValue[Value] = Entry;
+  DCache.pushFront(Entry);
+  DCache.TotalCost += Cost;
+  DCache.evictToFit();
 }
 
 bool CacheImpl::getAndRetain(const void *Key, void **Value_out) {
@@ -106,18 +244,31 @@ bool CacheImpl::getAndRetain(const void *Key, void **Value_out) {
   llvm::sys::ScopedLock L(DCache.Mux);
 
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
-  auto Entry = DCache.Entries.find(CKey);
-  if (Entry != DCache.Entries.end()) {
-    // FIXME: Not thread-safe! It should avoid deleting the value until
-    // 'releaseValue is called on it.
-    *Value_out = Entry->second;
+  auto Known = DCache.EntriesByKey.find(CKey);
+  if (Known != DCache.EntriesByKey.end()) {
+    EntryTy *Entry = Known->second;
+    ++Entry->ExternalRefs;
+    DCache.moveToFront(Entry);
+    ++DCache.Hits;
+    *Value_out = Entry->Value;
     return true;
   }
+  ++DCache.Misses;
   return false;
 }
 
 void CacheImpl::releaseValue(void *Value) {
-  // FIXME: Implementation.
+  DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
+  llvm::sys::ScopedLock L(DCache.Mux);
+
+  auto Known = DCache.EntriesByValue.find(Value);
+  assert(Known != DCache.EntriesByValue.end() && "releasing unknown value");
+  if (Known == DCache.EntriesByValue.end())
+    return;
+  EntryTy *Entry = Known->second;
+  assert(Entry->ExternalRefs > 0 && "unbalanced releaseValue");
+  --Entry->ExternalRefs;
+  DCache.destroyIfDead(Entry);
 }
 
 bool CacheImpl::remove(const void *Key) {
@@ -125,11 +276,9 @@ bool CacheImpl::remove(const void *Key) {
   llvm::sys::ScopedLock L(DCache.Mux);
 
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
-  auto Entry = DCache.Entries.find(CKey);
-  if (Entry != DCache.Entries.end()) {
-    DCache.CBs.keyDestroyCB(Entry->first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry->second, nullptr);
-    DCache.Entries.erase(Entry);
+  auto Known = DCache.EntriesByKey.find(CKey);
+  if (Known != DCache.EntriesByKey.end()) {
+    DCache.removeEntry(Known->second);
     return true;
   }
   return false;
@@ -139,16 +288,19 @@ void CacheImpl::removeAll() {
   DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
   llvm::sys::ScopedLock L(DCache.Mux);
 
-  for (auto Entry : DCache.Entries) {
-    DCache.CBs.keyDestroyCB(Entry.first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry.second, nullptr);
-  }
-  DCache.Entries.clear();
+  while (DCache.Head)
+    DCache.removeEntry(DCache.Head);
 }
 
 void CacheImpl::destroy() {
   removeAll();
-  delete static_cast<DefaultCache*>(Impl);
+  DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
+  if (::getenv("SWIFT_SYS_CACHE_STATS")) {
+    llvm::errs() << "swift::sys::Cache '" << DCache.Name
+                 << "': " << DCache.Hits << " hits, " << DCache.Misses
+                 << " misses, " << DCache.Evictions << " evictions\n";
+  }
+  delete &DCache;
 }
 
 #endif // finish default implementation
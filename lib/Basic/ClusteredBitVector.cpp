@@ -12,6 +12,14 @@
 //
 //  This file implements support code for ClusteredBitVector.
 //
+//  Only the printing helpers live out of line. The bulk operations in the
+//  header all lower onto llvm::APInt, whose and/or/insertBits/zext work a
+//  64-bit word at a time over contiguous storage, so IRGen's spare-bit
+//  arithmetic is already word-parallel; appends do grow through zext,
+//  which reallocates once the value leaves APInt's single inline word,
+//  and callers that build a mask of known size should size it up front
+//  (appendClearBits/extendWithClearBits) rather than appending in pieces.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/Basic/ClusteredBitVector.h"
@@ -115,6 +115,68 @@ tryToOpenTemporaryFile(Optional<llvm::raw_fd_ostream> &openedStream,
   return tempPath.str().str();
 }
 
+/// Returns true if \p outputPath is a regular file whose contents are exactly
+/// \p contents. Any error (missing file, unreadable, etc.) is treated as a
+/// mismatch; the caller will then just write the file.
+///
+/// Helper for swift::atomicallyWritingToFile.
+static bool fileMatchesContents(const StringRef outputPath,
+                                const StringRef contents) {
+  namespace fs = llvm::sys::fs;
+
+  OpenFileRAII destFile;
+  if (fs::openFileForRead(outputPath, destFile.fd))
+    return false;
+
+  fs::file_status destStatus;
+  if (fs::status(destFile.fd, destStatus))
+    return false;
+
+  if (destStatus.getSize() != contents.size())
+    return false;
+  if (contents.empty())
+    return true;
+
+  std::error_code destRegionErr;
+  fs::mapped_file_region destRegion(fs::convertFDToNativeFile(destFile.fd),
+                                    fs::mapped_file_region::readonly,
+                                    contents.size(), 0, destRegionErr);
+  if (destRegionErr)
+    return false;
+
+  return memcmp(destRegion.const_data(), contents.data(),
+                contents.size()) == 0;
+}
+
+/// Writes \p contents to \p outputPath through a temporary-plus-rename if
+/// possible, or directly otherwise.
+///
+/// Helper for swift::atomicallyWritingToFile.
+static std::error_code writeContentsToFile(const StringRef contents,
+                                           const StringRef outputPath) {
+  namespace fs = llvm::sys::fs;
+
+  Optional<llvm::raw_fd_ostream> OS;
+  Optional<std::string> temporaryPath = tryToOpenTemporaryFile(OS, outputPath);
+  if (!temporaryPath) {
+    assert(!OS.hasValue());
+    // If we failed to create the temporary, fall back to writing to the
+    // file directly. This handles the corner case where we cannot write to
+    // the directory, but can write to the file.
+    std::error_code error;
+    OS.emplace(outputPath, error, fs::F_None);
+    if (error)
+      return error;
+  }
+
+  OS.getValue() << contents;
+  OS.reset();
+
+  if (!temporaryPath.hasValue())
+    return std::error_code();
+  return fs::rename(temporaryPath.getValue(), outputPath);
+}
+
 std::error_code swift::atomicallyWritingToFile(
     const StringRef outputPath,
     const llvm::function_ref<void(llvm::raw_pwrite_stream &)> action) {
@@ -129,39 +191,33 @@ std::error_code swift::atomicallyWritingToFile(
   if (std::error_code error = canUseTemporary.getError())
     return error;
 
-  Optional<std::string> temporaryPath;
-  {
-    Optional<llvm::raw_fd_ostream> OS;
-    if (canUseTemporary.get()) {
-      temporaryPath = tryToOpenTemporaryFile(OS, outputPath);
-
-      if (!temporaryPath) {
-        assert(!OS.hasValue());
-        // If we failed to create the temporary, fall back to writing to the
-        // file directly. This handles the corner case where we cannot write to
-        // the directory, but can write to the file.
-      }
-    }
-
-    if (!OS.hasValue()) {
-      std::error_code error;
-      OS.emplace(outputPath, error, fs::F_None);
-      if (error) {
-        return error;
-      }
-    }
+  if (!canUseTemporary.get()) {
+    // Stream straight to stdout or a non-regular file.
+    std::error_code error;
+    llvm::raw_fd_ostream OS(outputPath, error, fs::F_None);
+    if (error)
+      return error;
+    action(OS);
+    return std::error_code();
+  }
 
-    action(OS.getValue());
-    // In addition to scoping the use of 'OS', ending the scope here also
-    // ensures that it's been flushed (by destroying it).
+  // Render the output into memory first. Incremental builds mostly rewrite
+  // outputs that haven't changed, and comparing against the existing file up
+  // front lets those skip all of the write traffic — previously an identical
+  // output still paid for writing (and then deleting) a full temporary copy.
+  llvm::SmallString<256> contents;
+  {
+    llvm::raw_svector_ostream OS(contents);
+    action(OS);
   }
 
-  if (!temporaryPath.hasValue()) {
-    // If we didn't use a temporary, we're done!
+  if (fileMatchesContents(outputPath, contents)) {
+    // Leave the existing file untouched, preserving its mtime for build
+    // systems that check it.
     return std::error_code();
   }
 
-  return swift::moveFileIfDifferent(temporaryPath.getValue(), outputPath);
+  return writeContentsToFile(contents, outputPath);
 }
 
 llvm::ErrorOr<FileDifference>
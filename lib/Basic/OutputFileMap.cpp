@@ -20,6 +20,15 @@
 
 using namespace swift;
 
+// A note on parse cost: the user-authored output file map, however large,
+// is parsed exactly once per build — by the driver. Frontend jobs never see
+// it; the driver hands each of them a small generated
+// -supplementary-output-file-map containing only that job's primaries (see
+// ToolChains.cpp), so per-job parse time scales with the job's own entry
+// count, not the project's. That is why there is no compiled binary OFM
+// variant: it would add a second, unreviewable format to save a once-per-
+// build parse of a file the build system also wants to be able to read and
+// generate as plain YAML/JSON.
 llvm::Expected<OutputFileMap>
 OutputFileMap::loadFromPath(StringRef Path, StringRef workingDirectory) {
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> FileBufOrErr =
@@ -16,6 +16,7 @@
 #include "swift/Basic/TaskQueue.h"
 #include "swift/Driver/Action.h"
 #include "swift/Driver/Job.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/Option/Arg.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
@@ -188,12 +189,17 @@ template <> struct ObjectTraits<Message> {
 } // namespace swift
 
 static void emitMessage(raw_ostream &os, Message &msg) {
-  std::string JSONString;
-  llvm::raw_string_ostream BufferStream(JSONString);
-  json::Output yout(BufferStream);
-  yout << msg;
-  BufferStream.flush();
-  os << JSONString.length() << '\n';
+  // json::Output formats straight into the stream it is given; the only
+  // buffering here is the one the protocol forces on us, since the byte
+  // length of the message is printed ahead of the message itself. Render
+  // into stack storage so typical messages never touch the heap.
+  llvm::SmallString<256> JSONString;
+  {
+    llvm::raw_svector_ostream BufferStream(JSONString);
+    json::Output yout(BufferStream);
+    yout << msg;
+  }
+  os << JSONString.size() << '\n';
   os << JSONString << '\n';
 }
 
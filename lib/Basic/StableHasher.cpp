@@ -37,6 +37,41 @@ static inline void sip_round(uint64_t &v0, uint64_t &v1, uint64_t &v2,
 }
 }; // end anonymous namespace
 
+// One 64-bit word per compression is as wide as this can go: each SipHash
+// round mixes the previous round's state into the next word, so there are
+// no independent lanes to vectorize across without defining a different
+// hash function — and these digests persist in swiftdeps files, where a
+// digest change means a full rebuild for every client.
+void StableHasher::combine_bytes(const uint8_t *bytes, uint64_t length) {
+  constexpr auto endian = llvm::support::endianness::little;
+  const uint64_t bufLen = getBufferLength();
+  lengthAndByteCount += length;
+
+  // Top up any buffered bytes to a full word and compress it.
+  if (bufLen > 0) {
+    const uint64_t available = sizeof(byteBuffer) - bufLen;
+    if (length < available) {
+      std::copy(bytes, bytes + length, byteBuffer + bufLen);
+      return setBufferLength(bufLen + length);
+    }
+    std::copy(bytes, bytes + available, byteBuffer + bufLen);
+    compress(llvm::support::endian::read<uint64_t>(byteBuffer, endian));
+    bytes += available;
+    length -= available;
+  }
+
+  // Compress whole words directly from the input.
+  while (length >= sizeof(byteBuffer)) {
+    compress(llvm::support::endian::read<uint64_t>(bytes, endian));
+    bytes += sizeof(byteBuffer);
+    length -= sizeof(byteBuffer);
+  }
+
+  // Reseed the buffer with the remaining bytes.
+  std::copy(bytes, bytes + length, byteBuffer);
+  setBufferLength(length);
+}
+
 void StableHasher::compress(uint64_t value) {
   state.v3 ^= value;
   for (unsigned i = 0; i < 2; ++i) {
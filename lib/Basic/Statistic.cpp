@@ -360,6 +360,15 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
   path::append(TraceFilename, makeTraceFileName(ProgramName, AuxName));
   path::append(ProfileDirname, makeProfileDirName(ProgramName, AuxName));
   EnableStatistics(/*PrintOnExit=*/false);
+  // The cost tiers here are deliberate. Plain -stats-output-dir only
+  // bumps always-on counters and writes one JSON file at process exit,
+  // which is cheap enough to leave enabled on every CI build;
+  // utils/process-stats-dir.py aggregates those per-job files into a
+  // build-wide view. The per-event trace and profile modes below are the
+  // expensive tiers — they snapshot every counter at every tracer
+  // entry/exit — and they buffer in memory until flush, so their cost is
+  // measurement work itself rather than trace-file I/O that a more
+  // compact encoding would recover.
   if (TraceEvents || ProfileEvents || ProfileEntities)
     LastTracedFrontendCounters.emplace();
   if (TraceEvents)
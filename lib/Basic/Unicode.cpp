@@ -51,6 +51,19 @@ StringRef swift::unicode::extractFirstExtendedGraphemeCluster(StringRef S) {
   if (S.empty())
     return StringRef();
 
+  // Fast path for ASCII followed by ASCII. No ASCII code point continues a
+  // cluster (none have the Extend, ZWJ-like, or SpacingMark properties), so
+  // the only multi-byte cluster entirely within ASCII is CR LF. A non-ASCII
+  // second byte could begin a combining scalar and takes the general path.
+  unsigned char First = S[0];
+  if (First < 0x80) {
+    if (S.size() == 1 || static_cast<unsigned char>(S[1]) < 0x80) {
+      if (First == '\r' && S.size() > 1 && S[1] == '\n')
+        return S.slice(0, 2);
+      return S.slice(0, 1);
+    }
+  }
+
   const llvm::UTF8 *SourceStart =
     reinterpret_cast<const llvm::UTF8 *>(S.data());
 
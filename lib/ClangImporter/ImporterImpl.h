@@ -416,6 +416,15 @@ private:
 
 public:
   /// Mapping of already-imported declarations.
+  ///
+  /// This cache is inherently per-invocation: both the keys (pointers into
+  /// this job's Clang AST) and the values (decls in this job's ASTContext
+  /// arenas) die with the frontend, so the importer's output cannot be
+  /// serialized next to the PCM and replayed by later jobs. What keeps the
+  /// repeated work bounded instead is laziness — decls are imported on
+  /// first lookup through the name-keyed SwiftLookupTables serialized in
+  /// the PCM, and members hang off LazyMemberLoaders — so each job pays
+  /// only for the part of the SDK surface it actually touches.
   llvm::DenseMap<std::pair<const clang::Decl *, Version>, Decl *> ImportedDecls;
 
   /// The set of "special" typedef-name declarations, which are
@@ -560,6 +560,12 @@ void SwiftLookupTable::addEntry(DeclName name, SingleEntry newEntry,
   updateTableWithEntry(newEntry, context, LookupTable[name.getBaseName()]);
 }
 
+// The DenseMap table is not a deserialized copy of the module's lookup
+// table; it is a memoization layer filled in one base name at a time. The
+// serialized form stays an on-disk hash table that is searched in place in
+// the module file's buffer, so loading a module costs nothing here and a
+// name that is never looked up is never decoded — which in turn means the
+// decls and members behind it are never imported.
 SwiftLookupTable::TableType::iterator
 SwiftLookupTable::findOrCreate(TableType &Table,
                                SerializedSwiftName baseName,
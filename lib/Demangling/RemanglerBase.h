@@ -124,6 +124,17 @@ protected:
   // Used to allocate temporary nodes and the output string (in Buffer).
   NodeFactory &Factory;
 
+  // The substitution table is inherently per-name state: a substitution is
+  // referenced in the output by its ordinal index ('A' + Idx), and the
+  // demangler recovers the table by replaying that one mangled string from
+  // the beginning. Seeding the table from a previous name would make the
+  // remangler emit indices for entries the consumer of the current name has
+  // never seen, producing manglings that don't round-trip. Sharing of common
+  // module/type prefixes across a batch of names therefore has to happen at
+  // a higher level (e.g. by caching whole remangled strings per node tree);
+  // within a single name, the inline array below keeps the common case free
+  // of mallocs.
+  //
   // An efficient hash-map implementation in the spirit of llvm's SmallPtrSet:
   // The first 16 substitutions are stored in an inline-allocated array to avoid
   // malloc calls in the common case.
@@ -300,6 +300,17 @@ static void discoverCrosssImportOverlayDependencies(
   allModules.insert({dummyMainName.str(), dummyMainDependencies.getKind()});
 
   // Explore the dependencies of every module.
+  //
+  // The frontier stays single-threaded not because of this loop but because
+  // of what each step calls into: every lookup funnels through the one
+  // scanning CompilerInstance — its ASTContext, its ClangImporter's
+  // dependency-scanning machinery, and the shared sub-invocation delegate
+  // for interface modules — none of which tolerates concurrent callers.
+  // Making ModuleDependenciesCache lockable would only move the
+  // serialization point, since cache misses (the entire cost of a cold
+  // scan) still resolve through that shared instance. Subtree-parallel
+  // scanning would need one scanning instance per worker and a merge step,
+  // duplicating exactly the Clang module probing it is meant to overlap.
   for (unsigned currentModuleIdx = 0; currentModuleIdx < allModules.size();
        ++currentModuleIdx) {
     auto module = allModules[currentModuleIdx];
@@ -1135,6 +1146,15 @@ static void deserializeDependencyCache(CompilerInstance &instance,
   }
 }
 
+// The scanner's contract is precisely to take PCM (and interface-module)
+// building out of the frontends: it emits the full transitive module graph
+// up front so the build system can schedule one deduplicated, topologically
+// ordered build job per module — in parallel across the whole graph — and
+// then hand each frontend its prebuilt inputs via the explicit module
+// flags. Serial on-demand PCM building only happens in implicit-modules
+// mode, where a frontend discovers missing modules mid-compilation; the
+// fix is to drive builds from this scan rather than to parallelize inside
+// the frontend.
 bool swift::dependencies::scanDependencies(CompilerInstance &instance) {
   ASTContext &Context = instance.getASTContext();
   const FrontendOptions &opts = instance.getInvocation().getFrontendOptions();
@@ -17,6 +17,15 @@
 namespace swift {
 namespace dependencies {
 
+// Each string is an individually-owned malloc'd copy because the C API says
+// so: swiftscan_string_dispose is public and must work on any string a
+// client received, whether it came embedded in a dependency graph or alone
+// from an accessor. Backing replies with a single arena would be faster to
+// marshal but breaks that ownership contract for every existing libSwiftScan
+// client, so a zero-copy reply format would have to come as a new API
+// surface, not a change to these types. The copies are a few hundred short
+// strings per scan — noise next to the scan itself.
+
 swiftscan_string_ref_t create_null() {
   swiftscan_string_ref_t str;
   str.data = nullptr;
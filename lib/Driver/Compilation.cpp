@@ -386,6 +386,16 @@ namespace driver {
     }
 
     /// When a task finishes, check other Jobs that may be blocked.
+    /// Completion is tracked at whole-job granularity: a dependent is
+    /// released only when the process that produces its inputs exits. There
+    /// is no finer signal to key on — a frontend job writes several
+    /// products (.o, .swiftmodule, supplementary outputs) but the TaskQueue
+    /// only observes pipes and the exit status, and a partially-written
+    /// product is indistinguishable from a complete one until then. The way
+    /// to unblock module-dependent downstream work before codegen finishes
+    /// is to give the module its own job that produces only the
+    /// .swiftmodule, so the dependency edge terminates on a process that
+    /// exits early, rather than to invent sub-job product states here.
     void markFinished(const Job *Cmd, bool Skipped=false) {
       if (Comp.getShowJobLifecycle()) {
         llvm::outs() << "Job "
@@ -1146,9 +1156,30 @@ namespace driver {
       return PartitionIndex;
     }
 
+    /// Return a cheap predicted cost for a batchable job: the size of its
+    /// primary source file. Compile time correlates well enough with input
+    /// size to balance batches, and the size is available before anything
+    /// has run. Returns at least 1 so jobs with unreadable inputs still
+    /// count toward a batch's load.
+    static uint64_t getPredictedJobCost(const Job *Cmd) {
+      uint64_t Size = 0;
+      StringRef Input = Cmd->getFirstSwiftPrimaryInput();
+      if (!Input.empty())
+        (void)llvm::sys::fs::file_size(Input, Size);
+      return std::max<uint64_t>(Size, 1);
+    }
+
     /// Create \c NumberOfParallelCommands batches and assign each job to a
-    /// batch either filling each partition in order or, if seeded with a
-    /// nonzero value, pseudo-randomly (but determinstically and nearly-evenly).
+    /// batch. Normally jobs are assigned longest-first to the least-loaded
+    /// batch (LPT scheduling) using the predicted per-job cost, so that one
+    /// expensive file does not land in a batch that already holds several
+    /// other expensive files. When seeded with a nonzero value, jobs are
+    /// instead spread pseudo-randomly (but deterministically and
+    /// nearly-evenly by count) for testing.
+    ///
+    /// Assignment order within a batch is irrelevant: \c constructBatchJob
+    /// re-sorts each batch's constituents to match the compilation's input
+    /// order.
     void partitionIntoBatches(std::vector<const Job *> Batchable,
                               BatchPartition &Partition) {
       if (Comp.getShowJobLifecycle()) {
@@ -1157,28 +1188,73 @@ namespace driver {
       }
 
       assert(!Partition.empty());
-      auto PartitionIndex = assignJobsToPartitions(Partition.size(),
-                                                   Batchable.size());
-      assert(PartitionIndex.size() == Batchable.size());
       auto const &TC = Comp.getToolChain();
-      for_each(Batchable, PartitionIndex, [&](const Job *Cmd, size_t Idx) {
-          assert(Idx < Partition.size());
-          std::vector<const Job*> &P = Partition[Idx];
-          if (P.empty() || TC.jobsAreBatchCombinable(Comp, P[0], Cmd)) {
-            if (Comp.getShowJobLifecycle())
-              llvm::outs() << "Adding " << LogJob(Cmd)
-                           << " to batch " << Idx << '\n';
-            P.push_back(Cmd);
-          } else {
-            // Strange but theoretically possible that we have a batchable job
-            // that's not combinable with others; tack a new batch on for it.
-            if (Comp.getShowJobLifecycle())
-              llvm::outs() << "Adding " << LogJob(Cmd)
-                           << " to new batch " << Partition.size() << '\n';
-            Partition.push_back(std::vector<const Job*>());
-            Partition.back().push_back(Cmd);
-          }
-        });
+
+      if (Comp.getBatchSeed() != 0) {
+        auto PartitionIndex = assignJobsToPartitions(Partition.size(),
+                                                     Batchable.size());
+        assert(PartitionIndex.size() == Batchable.size());
+        for_each(Batchable, PartitionIndex, [&](const Job *Cmd, size_t Idx) {
+            assert(Idx < Partition.size());
+            std::vector<const Job*> &P = Partition[Idx];
+            if (P.empty() || TC.jobsAreBatchCombinable(Comp, P[0], Cmd)) {
+              if (Comp.getShowJobLifecycle())
+                llvm::outs() << "Adding " << LogJob(Cmd)
+                             << " to batch " << Idx << '\n';
+              P.push_back(Cmd);
+            } else {
+              // Strange but theoretically possible that we have a batchable
+              // job that's not combinable with others; tack a new batch on
+              // for it.
+              if (Comp.getShowJobLifecycle())
+                llvm::outs() << "Adding " << LogJob(Cmd)
+                             << " to new batch " << Partition.size() << '\n';
+              Partition.push_back(std::vector<const Job*>());
+              Partition.back().push_back(Cmd);
+            }
+          });
+        return;
+      }
+
+      std::vector<std::pair<const Job *, uint64_t>> Costed;
+      Costed.reserve(Batchable.size());
+      for (const Job *Cmd : Batchable)
+        Costed.push_back({Cmd, getPredictedJobCost(Cmd)});
+      std::stable_sort(Costed.begin(), Costed.end(),
+                       [](const std::pair<const Job *, uint64_t> &LHS,
+                          const std::pair<const Job *, uint64_t> &RHS) {
+                         return LHS.second > RHS.second;
+                       });
+
+      const size_t None = ~size_t(0);
+      std::vector<uint64_t> Load(Partition.size(), 0);
+      for (auto const &Entry : Costed) {
+        const Job *Cmd = Entry.first;
+        size_t Best = None;
+        for (size_t Idx = 0; Idx < Partition.size(); ++Idx) {
+          std::vector<const Job *> &P = Partition[Idx];
+          if (!P.empty() && !TC.jobsAreBatchCombinable(Comp, P[0], Cmd))
+            continue;
+          if (Best == None || Load[Idx] < Load[Best])
+            Best = Idx;
+        }
+        if (Best == None) {
+          // Strange but theoretically possible that we have a batchable job
+          // that's not combinable with others; tack a new batch on for it.
+          if (Comp.getShowJobLifecycle())
+            llvm::outs() << "Adding " << LogJob(Cmd)
+                         << " to new batch " << Partition.size() << '\n';
+          Partition.push_back(std::vector<const Job *>());
+          Partition.back().push_back(Cmd);
+          Load.push_back(Entry.second);
+          continue;
+        }
+        if (Comp.getShowJobLifecycle())
+          llvm::outs() << "Adding " << LogJob(Cmd)
+                       << " to batch " << Best << '\n';
+        Partition[Best].push_back(Cmd);
+        Load[Best] += Entry.second;
+      }
     }
 
     // Selects the number of partitions based on the user-provided batch
@@ -1305,6 +1381,16 @@ namespace driver {
     /// them together into \p BatchJob instances (also inserted into \p
     /// BatchJobs), and enqueue all \c PendingExecution jobs (whether batched or
     /// not) into the \c TaskQueue for execution.
+    ///
+    /// Batching is this driver's mechanism for amortizing the fixed
+    /// per-process costs (startup, stdlib/SDK module loading, ClangImporter
+    /// warm-up) across many primary files: one frontend invocation pays
+    /// them once for a whole partition. Keeping warm frontend *processes*
+    /// alive across driver invocations instead would require a frontend
+    /// that can reset to a new invocation — ASTContext, loaded modules,
+    /// and importer state have no teardown/reconfigure path and silently
+    /// embed the old invocation's options — so job isolation is a process
+    /// boundary by design.
     void formBatchJobsAndAddPendingJobsToTaskQueue() {
 
       // If batch mode is not enabled, just transfer the set of pending jobs to
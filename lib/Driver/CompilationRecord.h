@@ -21,6 +21,16 @@ namespace compilation_record {
 
 /// Compilation record files (-master.swiftdeps files) are YAML files composed
 /// of these top-level keys.
+///
+/// The format stays textual on purpose. The record is an interchange point,
+/// not a private cache: the replacement Swift driver reads and writes the
+/// same file so the two drivers can alternate on a build without discarding
+/// incremental state, and build engineers regularly inspect it by hand when
+/// diagnosing why something rebuilt. It also holds one small entry per
+/// input file, so parsing is proportional to the target's input list —
+/// a binary mmap format would save a YAML walk measured in fractions of a
+/// millisecond per hundred files at the price of a format break with the
+/// other driver.
 enum class TopLevelKey {
   /// The key for the Swift compiler version used to produce the compilation
   /// record.
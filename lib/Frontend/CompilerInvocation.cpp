@@ -1915,6 +1915,17 @@ static bool ParseMigratorArgs(MigratorOptions &Opts,
   return false;
 }
 
+// This runs exactly once per frontend process, so there is nothing to
+// memoize within a process, and an on-disk cache of resolved invocations
+// does not pay for itself: the resolved state is the whole set of option
+// structs (strings, search paths, inferred triples), so rehydrating it
+// costs about what parsing the argument vector costs, while the cache key
+// would have to capture everything the resolution consults besides the
+// arguments — the working directory, the main executable path (runtime
+// resource dir discovery), environment, and the existence of the paths
+// being normalized. Diagnostics emitted during parsing would also have to
+// be replayed. Jobs that want to amortize per-process startup should be
+// batched rather than given faster argument parsing.
 bool CompilerInvocation::parseArgs(
     ArrayRef<const char *> Args, DiagnosticEngine &Diags,
     SmallVectorImpl<std::unique_ptr<llvm::MemoryBuffer>>
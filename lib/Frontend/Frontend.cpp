@@ -1032,7 +1032,12 @@ bool CompilerInstance::performParseAndResolveImportsOnly() {
     }
   }
 
-  // Resolve imports for all the source files.
+  // Resolve imports for all the source files. This also triggers parsing of
+  // each file. Note that although source files are independent at parse time,
+  // parsing cannot be farmed out to a thread pool: all files share the
+  // ASTContext's identifier table, allocation arenas, and DiagnosticEngine,
+  // none of which are thread-safe, and diagnostics must be emitted in a
+  // deterministic order.
   for (auto *file : mainModule->getFiles()) {
     if (auto *SF = dyn_cast<SourceFile>(file))
       performImportResolution(*SF);
@@ -1160,11 +1165,20 @@ CompilerInstance::getSourceFileParsingOptions(bool forPrimary) const {
       opts |= SourceFile::ParsingFlags::DisableDelayedBodies;
   }
 
+  // Dependency scanning and import emission only care about the top-level
+  // decl skeleton; even though they run without primaries, keep delayed body
+  // parsing enabled so function bodies and member lists are skipped over
+  // instead of parsed.
+  const bool onlyNeedsImports =
+      action == FrontendOptions::ActionType::ScanDependencies ||
+      action == FrontendOptions::ActionType::EmitImportedModules;
+
   if (forPrimary || isWholeModuleCompilation()) {
     // Disable delayed body parsing for primaries and in WMO, unless
     // forcefully skipping function bodies
     auto typeOpts = getASTContext().TypeCheckerOpts;
-    if (typeOpts.SkipFunctionBodies == FunctionBodySkipping::None)
+    if (typeOpts.SkipFunctionBodies == FunctionBodySkipping::None &&
+        !onlyNeedsImports)
       opts |= SourceFile::ParsingFlags::DisableDelayedBodies;
   } else {
     // Suppress parse warnings for non-primaries, as they'll get parsed multiple
@@ -1515,6 +1515,15 @@ StringRef InterfaceSubContextDelegateImpl::computeCachedOutputPath(
 /// -- rather than making a new one and potentially filling up the cache
 /// with dead entries -- when other factors change, such as the contents of
 /// the .swiftinterface input or its dependencies.
+///
+/// This is also why the key is not a content hash: keying on content would
+/// turn every interface edit into a fresh entry with no eviction story,
+/// and the content check would still have to be repeated against every
+/// dependency on each use. Instead, freshness is a property of the cache
+/// entry (validated against the recorded size/hash of each dependency),
+/// and sharing validated modules across users and builders is the job of
+/// the read-only prebuilt module cache, whose entries carry hash-based
+/// forwarding information for exactly this purpose.
 std::string
 InterfaceSubContextDelegateImpl::getCacheHash(StringRef useInterfacePath) {
   auto normalizedTargetTriple =
@@ -1574,6 +1583,15 @@ InterfaceSubContextDelegateImpl::runInSubContext(StringRef moduleName,
   });
 }
 
+// Interface builds triggered from here are inherently serial and recursive:
+// a dependency interface is only discovered while the parent's sub-instance
+// is importing it, so there is no graph to schedule from inside this
+// process — the frontier is always one module wide. Turning the discovered
+// dependencies into parallel subprocess builds is the dependency scanner's
+// job (-scan-dependencies emits the full interface/PCM graph so the build
+// system can prebuild independent modules concurrently and hand frontends
+// explicit modules); this path is the fallback for implicit builds, where
+// correctness comes from per-entry cache locking rather than scheduling.
 std::error_code
 InterfaceSubContextDelegateImpl::runInSubCompilerInstance(StringRef moduleName,
                                                           StringRef interfacePath,
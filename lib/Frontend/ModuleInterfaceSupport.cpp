@@ -654,6 +654,18 @@ const StringLiteral InheritedProtocolCollector::DummyProtocolName =
 
 // MARK: Interface emission
 
+/// Most of the time here is not spent appending characters: printing a decl
+/// forces its signature, generic environment, members and synthesized
+/// conformances through the request evaluator, all of which mutate the
+/// shared ASTContext. That makes partitioning the top-level decls across
+/// threads unsafe — concurrent printers would race on the same lazy state —
+/// and it is also why a "shareable type-printing cache" would not help: the
+/// expensive lookups are evaluator requests, which are already cached per
+/// context. Printing stays serial; the effective levers are typechecking
+/// less (e.g. -experimental-skip-non-inlinable-function-bodies, which these
+/// builds already pass) and keeping interface emission off the critical
+/// path by scheduling it alongside dependents that only need the
+/// swiftmodule.
 bool swift::emitSwiftInterface(raw_ostream &out,
                                ModuleInterfaceOptions const &Opts,
                                ModuleDecl *M) {
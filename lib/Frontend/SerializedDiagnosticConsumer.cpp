@@ -63,7 +63,12 @@ struct SharedState : llvm::RefCountedBase<SharedState> {
         SerializedDiagnosticsPath(serializedDiagnosticsPath),
         EmittedAnyDiagBlocks(false) {}
 
-  /// The byte buffer for the serialized content.
+  /// The byte buffer for the serialized content. All records — including the
+  /// string data interleaved by the bitstream abbreviations — are encoded
+  /// into this in-memory buffer as diagnostics arrive; the .dia file itself
+  /// is written exactly once, in finishProcessing() at the end of the job.
+  /// Per-diagnostic emission therefore never touches the filesystem, which
+  /// matters when the output lives on a network mount.
   llvm::SmallString<1024> Buffer;
 
   /// The BitStreamWriter for the serialized diagnostics.
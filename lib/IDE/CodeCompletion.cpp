@@ -6581,6 +6581,16 @@ static void postProcessResults(MutableArrayRef<CodeCompletionResult *> results,
   }
 }
 
+/// Hand the completion results to \p Consumer. The bulk results — the tens
+/// of thousands of globals visible at a top-level position — are not built
+/// here: they are deferred as RequestedCachedModule keys, and the consumer
+/// resolves each key against the per-module completion cache, where the
+/// results were materialized once and are pointer-copied into the request
+/// sink (copyCodeCompletionResults retains the source allocator rather
+/// than rebuilding strings). Only context-specific results are constructed
+/// per request, so the lazy layer a provider-stream redesign would add
+/// already exists at the module-cache boundary; what a request pays for
+/// the globals is the filtered pointer copy, not string construction.
 static void deliverCompletionResults(CodeCompletionContext &CompletionContext,
                                      CompletionLookup &Lookup,
                                      DeclContext *DC,
@@ -104,6 +104,17 @@ static constexpr uint32_t onDiskCompletionCacheVersion = 1;
 
 /// Deserializes CodeCompletionResults from \p in and stores them in \p V.
 /// \see writeCacheModule.
+///
+/// Deserialization materializes results into the value's sink allocator
+/// rather than pointing them into the file buffer, and that is forced by
+/// the sink ownership model: results travel between sinks with only a
+/// shared_ptr to their BumpPtrAllocator as the keep-alive token (see
+/// CodeCompletionResultSink::ForeignAllocators), so strings referencing an
+/// mmap would dangle as soon as the buffer's owner went away — there is no
+/// seat for a file buffer in that contract. The on-disk cache itself is
+/// already the cross-process sharing mechanism: every SourceKit worker
+/// reads the same mtime-validated file and pays this materialization once
+/// per module per process, after which lookups hit the in-memory cache.
 static bool readCachedModule(llvm::MemoryBuffer *in,
                              const CodeCompletionCache::Key &K,
                              CodeCompletionCache::Value &V,
@@ -741,6 +741,16 @@ SourceFile *getContainingFile(ModuleDecl *M, RangeConfig Range) {
   return nullptr;
 }
 
+/// Actions operate on a fully type-checked file, and for cursor-based
+/// kinds that is a real requirement rather than an oversight: rename and
+/// its relatives must resolve every reference in the file, and references
+/// can sit inside any function body, so scoped checking of just the
+/// enclosing context (the typeCheckASTNodeAtLoc path code completion
+/// uses) would miss them. The latency lever is reuse, not scope —
+/// SourceKit's SwiftASTManager caches the type-checked AST per document
+/// snapshot, so consecutive refactoring requests against an unchanged
+/// buffer skip Sema entirely, and cursor resolution below goes through
+/// the evaluator's cached CursorInfoRequest.
 class RefactoringAction {
 protected:
   ModuleDecl *MD;
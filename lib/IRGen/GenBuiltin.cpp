@@ -1016,6 +1016,12 @@ if (Builtin.ID == BuiltinValueKind::id) { \
     if (auto ExpectedPred = IGF.IGM.TargetInfo.OnceDonePredicateValue) {
       auto PredValue = IGF.Builder.CreateLoad(PredPtr,
                                               IGF.IGM.getPointerAlignment());
+      // On Darwin a plain load suffices: dispatch_once publishes the done
+      // value behind a maximally-synchronizing barrier on the writer side.
+      // The Linux runtime publishes with an ordinary release store, which
+      // only synchronizes with an acquire load of the predicate.
+      if (!IGF.IGM.Triple.isOSDarwin())
+        PredValue->setAtomic(llvm::AtomicOrdering::Acquire);
       auto ExpectedPredValue = llvm::ConstantInt::getSigned(IGF.IGM.OnceTy,
                                                             *ExpectedPred);
       auto PredIsDone = IGF.Builder.CreateICmpEQ(PredValue, ExpectedPredValue);
@@ -113,6 +113,7 @@
 #include "llvm/IR/CFG.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/GlobalVariable.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/CFG.h"
 #include "llvm/Support/Compiler.h"
 #include "clang/CodeGen/SwiftCallingConv.h"
@@ -137,6 +138,13 @@
 using namespace swift;
 using namespace irgen;
 
+STATISTIC(NumSingletonEnumStrategies, "# of singleton enum strategies");
+STATISTIC(NumNoPayloadEnumStrategies, "# of no-payload enum strategies");
+STATISTIC(NumCCompatibleEnumStrategies, "# of C-compatible enum strategies");
+STATISTIC(NumSinglePayloadEnumStrategies, "# of single-payload enum strategies");
+STATISTIC(NumMultiPayloadEnumStrategies, "# of multi-payload enum strategies");
+STATISTIC(NumResilientEnumStrategies, "# of resilient enum strategies");
+
 static llvm::Constant *emitEnumLayoutFlags(IRGenModule &IGM, bool isVWTMutable){
   // For now, we always use the Swift 5 algorithm.
   auto flags = EnumLayoutFlags::Swift5Algorithm;
@@ -5980,6 +5988,18 @@ namespace {
   };
 } // end anonymous namespace
 
+/// Classify an enum and build the strategy that implements its layout and
+/// access operations.
+///
+/// This runs at most once per canonical lowered enum type: the resulting
+/// strategy is owned by the TypeInfo that TypeConverter caches for the type,
+/// and all later queries go through that cache (see getEnumImplStrategy).
+/// Strategies cannot be shared more aggressively than that — even between
+/// structurally identical enums — because a strategy captures the enum's
+/// EnumElementDecls and the TypeInfos of its payloads, and the spare-bit
+/// math below depends on the payload types' lowered representations rather
+/// than just their shapes. The statistics above exist to check that the
+/// per-type cache is doing its job on enum-heavy inputs.
 std::unique_ptr<EnumImplStrategy>
 EnumImplStrategy::get(TypeConverter &TC, SILType type, EnumDecl *theEnum) {
   unsigned numElements = 0;
@@ -6084,6 +6104,7 @@ EnumImplStrategy::get(TypeConverter &TC, SILType type, EnumDecl *theEnum) {
          && "not all elements accounted for");
 
   if (isResilient) {
+    ++NumResilientEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(
             new ResilientEnumImplStrategy(TC.IGM,
                                          numElements,
@@ -6093,6 +6114,7 @@ EnumImplStrategy::get(TypeConverter &TC, SILType type, EnumDecl *theEnum) {
 
   // namespace-like enums must be imported as empty decls.
   if (theEnum->hasClangNode() && numElements == 0 && !theEnum->isObjC()) {
+    ++NumSingletonEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(new SingletonEnumImplStrategy(
         TC.IGM, tik, alwaysFixedSize, numElements,
         std::move(elementsWithPayload), std::move(elementsWithNoPayload)));
@@ -6102,6 +6124,7 @@ EnumImplStrategy::get(TypeConverter &TC, SILType type, EnumDecl *theEnum) {
   if (theEnum->hasClangNode() || theEnum->isObjC()) {
     assert(elementsWithPayload.empty() && "C enum with payload?!");
     assert(alwaysFixedSize == IsFixedSize && "C enum with resilient payload?!");
+    ++NumCCompatibleEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(
            new CCompatibleEnumImplStrategy(TC.IGM, tik, alwaysFixedSize,
                                            numElements,
@@ -6109,26 +6132,33 @@ EnumImplStrategy::get(TypeConverter &TC, SILType type, EnumDecl *theEnum) {
                                            std::move(elementsWithNoPayload)));
   }
 
-  if (numElements <= 1)
+  if (numElements <= 1) {
+    ++NumSingletonEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(
           new SingletonEnumImplStrategy(TC.IGM, tik, alwaysFixedSize,
                                          numElements,
                                          std::move(elementsWithPayload),
                                          std::move(elementsWithNoPayload)));
-  if (elementsWithPayload.size() > 1)
+  }
+  if (elementsWithPayload.size() > 1) {
+    ++NumMultiPayloadEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(
            new MultiPayloadEnumImplStrategy(TC.IGM, tik, alwaysFixedSize,
                                             allowFixedLayoutOptimizations,
                                             numElements,
                                             std::move(elementsWithPayload),
                                             std::move(elementsWithNoPayload)));
-  if (elementsWithPayload.size() == 1)
+  }
+  if (elementsWithPayload.size() == 1) {
+    ++NumSinglePayloadEnumStrategies;
     return std::unique_ptr<EnumImplStrategy>(
            new SinglePayloadEnumImplStrategy(TC.IGM, tik, alwaysFixedSize,
                                              numElements,
                                              std::move(elementsWithPayload),
                                              std::move(elementsWithNoPayload)));
+  }
 
+  ++NumNoPayloadEnumStrategies;
   return std::unique_ptr<EnumImplStrategy>(
          new NoPayloadEnumImplStrategy(TC.IGM, tik, alwaysFixedSize,
                                        numElements,
@@ -12,6 +12,16 @@
 //
 //  This file implements IR generation for type metadata constructs.
 //
+//  Metadata that can be demanded from several translation units —
+//  prespecialized generic metadata, witness tables, outlined value
+//  functions — is emitted in each job that needs it and deduplicated by the
+//  linker through linkonce_odr/ODR linkage rather than by any cross-job
+//  coordination. A build-wide emission cache would need the driver to
+//  sequence jobs against each other and to know, before a job runs, which
+//  lazily-demanded entities it will reach, neither of which the current
+//  job-parallel driver model provides; within one job, each entity is
+//  emitted at most once via the lazy emission queues in IRGenerator.
+//
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "type-metadata-layout"
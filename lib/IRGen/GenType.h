@@ -67,6 +67,19 @@ namespace irgen {
   class TypeInfo;
   
 /// The helper class for generating types.
+///
+/// There is one TypeConverter per IRGenModule, so in multithreaded IRGen
+/// each IGM lowers the types it uses independently and the same canonical
+/// type may be converted several times per process. That duplication cannot
+/// be hoisted into a shared cache on IRGenerator: every TypeInfo and
+/// Signature holds llvm::Type and attribute objects created in its IGM's
+/// own LLVMContext, and LLVM IR objects are not valid outside the context
+/// that produced them. The context-per-IGM split is what lets the LLVM
+/// pipelines run on separate threads without locking, so the redundant
+/// lowering is the price of that parallelism. The context-independent part
+/// of the work — SIL-level type lowering — already lives in the shared
+/// Lowering::TypeConverter on the SILModule and is computed once per
+/// process.
 class TypeConverter {
 public:
   enum class Mode : unsigned {
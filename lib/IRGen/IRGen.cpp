@@ -1259,7 +1259,14 @@ static void performParallelIRGeneration(IRGenDescriptor desc) {
   bool IGMcreated = false;
 
   auto &Ctx = M->getASTContext();
-  // Create an IRGenModule for each source file.
+  // Create an IRGenModule for each source file. The partition must stay
+  // file-based even though file sizes are skewed: the driver hands us one
+  // output filename per input file and incremental builds expect each object
+  // to correspond to its source file, so a cost-balanced split of functions
+  // across LLVM modules would break the output contract. Within that
+  // constraint, lazily emitted functions with no home file (and all
+  // specializations of a given original) are steered to whichever module is
+  // current, which spreads some of the load; see IRGenerator::addLazyFunction.
   bool DidRunSILCodeGenPreparePasses = false;
   for (auto *File : M->getFiles()) {
     auto nextSF = dyn_cast<SourceFile>(File);
@@ -196,6 +196,13 @@ SwiftTargetInfo SwiftTargetInfo::get(IRGenModule &IGM) {
   // which exposes a barrier-free inline path with -1 as the "done" value.
   if (triple.isOSDarwin())
     target.OnceDonePredicateValue = -1L;
+  // On Linux, the runtime implements swift_once itself and publishes -1
+  // into the predicate with a release store when initialization completes
+  // (see stdlib/public/runtime/Once.cpp). Unlike Darwin there is no
+  // heavyweight barrier on the writer side, so IRGen emits the inline
+  // check as an atomic acquire load (see GenBuiltin.cpp).
+  else if (triple.isOSLinux())
+    target.OnceDonePredicateValue = -1L;
   // Other platforms use std::call_once() and we don't
   // assume that they have a barrier-free inline fast path.
   
@@ -30,10 +30,16 @@
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/Config/config.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/ExecutionEngine/Orc/CompileUtils.h"
 #include "llvm/ExecutionEngine/Orc/DebugUtils.h"
 #include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
 #include "llvm/ExecutionEngine/Orc/LLJIT.h"
 #include "llvm/ExecutionEngine/Orc/OrcRPCTargetProcessControl.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/Transforms/IPO.h"
 #include "llvm/Transforms/IPO/PassManagerBuilder.h"
@@ -89,6 +95,82 @@ static void DumpLLVMIR(const llvm::Module &M) {
   M.print(stream, /*AssemblyAnnotationWriter=*/nullptr);
 }
 
+namespace {
+/// An on-disk cache of JIT-compiled objects for immediate mode, enabled by
+/// pointing SWIFT_IMMEDIATE_OBJECT_CACHE at a directory. Entries are keyed
+/// by a hash of the IR module's bitcode together with the target
+/// configuration, so a hit is valid by construction and no separate
+/// invalidation is needed; unchanged scripts skip the LLVM back-end on
+/// repeat runs. Stale entries are never evicted — the tooling that opts in
+/// is expected to prune the directory.
+class ImmediateObjectCache : public llvm::ObjectCache {
+  std::string CacheDir;
+  /// Target triple, CPU and features, folded into every key so one
+  /// directory can safely serve differently-configured invocations.
+  std::string ConfigKey;
+
+public:
+  ImmediateObjectCache(StringRef cacheDir, StringRef configKey)
+      : CacheDir(cacheDir), ConfigKey(configKey) {}
+
+  void notifyObjectCompiled(const llvm::Module *module,
+                            llvm::MemoryBufferRef obj) override {
+    if (llvm::sys::fs::create_directories(CacheDir))
+      return;
+
+    llvm::SmallString<256> path;
+    getCachePath(module, path);
+
+    // Write to a unique temporary and rename so that concurrent runs of the
+    // same script never observe a partial object.
+    llvm::SmallString<256> tempPath;
+    int tempFD;
+    if (llvm::sys::fs::createUniqueFile(path + ".tmp-%%%%%%", tempFD,
+                                        tempPath))
+      return;
+    {
+      llvm::raw_fd_ostream out(tempFD, /*shouldClose=*/true);
+      out << obj.getBuffer();
+    }
+    if (llvm::sys::fs::rename(tempPath, path))
+      llvm::sys::fs::remove(tempPath);
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer>
+  getObject(const llvm::Module *module) override {
+    llvm::SmallString<256> path;
+    getCachePath(module, path);
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer)
+      return nullptr;
+    return std::move(*buffer);
+  }
+
+private:
+  void getCachePath(const llvm::Module *module,
+                    llvm::SmallVectorImpl<char> &path) {
+    // Hash the bitcode rather than the source text: it fingerprints the
+    // post-Sema semantics of the script, including anything pulled in from
+    // imported modules, which a source hash would miss.
+    llvm::SmallString<0> bitcode;
+    {
+      llvm::raw_svector_ostream os(bitcode);
+      llvm::WriteBitcodeToFile(*module, os);
+    }
+    llvm::MD5 hash;
+    hash.update(ConfigKey);
+    hash.update(bitcode);
+    llvm::MD5::MD5Result result;
+    hash.final(result);
+
+    path.clear();
+    path.append(CacheDir.begin(), CacheDir.end());
+    auto digest = result.digest();
+    llvm::sys::path::append(path, llvm::Twine("immediate-") + digest + ".o");
+  }
+};
+} // end anonymous namespace
+
 void *swift::immediate::loadSwiftRuntime(ArrayRef<std::string>
                                          runtimeLibPaths) {
 #if defined(_WIN32)
@@ -298,25 +380,75 @@ int swift::RunImmediately(CompilerInstance &CI,
   std::tie(TargetOpt, CPU, Features, Triple)
     = getIRTargetOptions(IRGenOpts, swiftModule->getASTContext());
 
+  // Prefer a lazy JIT so that functions are only compiled to machine code
+  // when they are first called. Scripts typically execute a small slice of
+  // the code they declare, and the deferred work never happens for the
+  // rest. Note that laziness starts at the LLVM IR level: SIL generation
+  // and IRGen are module-at-a-time and have already run by this point.
+  // If requested via the environment, reuse machine code from earlier runs
+  // of the same (unchanged) script. Only the LLVM back-end is skipped on a
+  // hit; parsing, Sema, SIL and IRGen have already run by this point.
+  std::unique_ptr<ImmediateObjectCache> ObjectCache;
+  if (const char *cacheDir = ::getenv("SWIFT_IMMEDIATE_OBJECT_CACHE")) {
+    std::string configKey = Triple;
+    configKey += '\0';
+    configKey += CPU;
+    for (auto &feature : Features) {
+      configKey += '\0';
+      configKey += feature;
+    }
+    ObjectCache =
+        std::make_unique<ImmediateObjectCache>(cacheDir, configKey);
+  }
+
+  auto CreateCachingCompiler = [&ObjectCache](
+      llvm::orc::JITTargetMachineBuilder JTMB)
+      -> llvm::Expected<
+          std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+    auto TM = JTMB.createTargetMachine();
+    if (!TM)
+      return TM.takeError();
+    return std::make_unique<llvm::orc::TMOwningSimpleCompiler>(
+        std::move(*TM), ObjectCache.get());
+  };
+
   std::unique_ptr<llvm::orc::LLJIT> JIT;
+  llvm::orc::LLLazyJIT *LazyJIT = nullptr;
 
   {
-    auto JITOrErr =
-      llvm::orc::LLJITBuilder()
-        .setJITTargetMachineBuilder(
-            llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
-              .setRelocationModel(llvm::Reloc::PIC_)
-              .setOptions(std::move(TargetOpt))
-              .setCPU(std::move(CPU))
-              .addFeatures(Features)
-              .setCodeGenOptLevel(llvm::CodeGenOpt::Default))
-        .create();
-
-    if (!JITOrErr) {
-      llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
-      return -1;
-    } else
-      JIT = std::move(*JITOrErr);
+    auto JTMB = llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
+                    .setRelocationModel(llvm::Reloc::PIC_)
+                    .setOptions(std::move(TargetOpt))
+                    .setCPU(std::move(CPU))
+                    .addFeatures(Features)
+                    .setCodeGenOptLevel(llvm::CodeGenOpt::Default);
+
+    llvm::orc::LLLazyJITBuilder LazyBuilder;
+    LazyBuilder.setJITTargetMachineBuilder(JTMB);
+    if (ObjectCache)
+      LazyBuilder.setCompileFunctionCreator(CreateCachingCompiler);
+    auto LazyJITOrErr = LazyBuilder.create();
+
+    if (LazyJITOrErr) {
+      LazyJIT = LazyJITOrErr->get();
+      JIT = std::move(*LazyJITOrErr);
+    } else {
+      // Lazy call-throughs aren't supported on every target; fall back to
+      // compiling the whole module up front.
+      llvm::consumeError(LazyJITOrErr.takeError());
+
+      llvm::orc::LLJITBuilder Builder;
+      Builder.setJITTargetMachineBuilder(std::move(JTMB));
+      if (ObjectCache)
+        Builder.setCompileFunctionCreator(CreateCachingCompiler);
+      auto JITOrErr = Builder.create();
+
+      if (!JITOrErr) {
+        llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
+        return -1;
+      } else
+        JIT = std::move(*JITOrErr);
+    }
   }
 
   auto Module = GenModule.getModule();
@@ -347,7 +479,10 @@ int swift::RunImmediately(CompilerInstance &CI,
              Module->dump());
 
   {
-    if (auto Err = JIT->addIRModule(std::move(GenModule).intoThreadSafeContext())) {
+    auto TSM = std::move(GenModule).intoThreadSafeContext();
+    auto Err = LazyJIT ? LazyJIT->addLazyIRModule(std::move(TSM))
+                       : JIT->addIRModule(std::move(TSM));
+    if (Err) {
       llvm::logAllUnhandledErrors(std::move(Err), llvm::errs(), "");
       return -1;
     }
@@ -1609,6 +1609,17 @@ void IndexSwiftASTWalker::collectRecursiveModuleImports(
 // Indexing entry points
 //===----------------------------------------------------------------------===//
 
+// These walks are serial per frontend invocation, and that is not an
+// accident of the loop structure: the walker pulls USRs, accessors, and
+// implicit members through the request evaluator as it goes, so a walk
+// mutates the shared ASTContext even for declarations that were already
+// type checked. Sharding the walk per source file onto threads would race
+// on that lazy state. The parallelism for index-while-building lives a
+// level up — the build system already runs one frontend job per primary
+// file group, and each job only indexes its own primaries plus any
+// modules whose units are missing (see IndexRecord.cpp, which skips units
+// that are already up to date in the store).
+
 void index::indexDeclContext(DeclContext *DC, IndexDataConsumer &consumer) {
   assert(DC);
   SourceFile *SF = DC->getParentSourceFile();
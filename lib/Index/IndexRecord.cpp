@@ -267,6 +267,15 @@ StringRef StdlibGroupsIndexRecordingConsumer::findGroupForSymbol(const IndexSymb
   llvm_unreachable("did not find group name for reference");
 }
 
+/// Emit one record file for \p record through clang's IndexRecordWriter.
+/// The on-disk format belongs to the clang index store, not to us: every
+/// consumer reads records through the store API, so changes such as a
+/// cross-record string table or compressed bodies have to land in
+/// clang/lib/Index's writer and reader together, and cannot be introduced
+/// from this side. The store does already contain the big size lever —
+/// record names are content hashes, so identical records (common for
+/// generated or unchanged files) collapse to a single file, which is why
+/// beginRecord can answer AlreadyExists and we skip the write entirely.
 static bool writeRecord(SymbolTracker &record, std::string Filename,
                         std::string indexStorePath, DiagnosticEngine *diags,
                         std::string &outRecordFile) {
@@ -1006,6 +1006,13 @@ void SwiftARCOpt::getAnalysisUsage(llvm::AnalysisUsage &AU) const {
   AU.setPreservesCFG();
 }
 
+// Note on parallelism: this deliberately stays a function pass. Turning it
+// into a module pass that fans functions out to threads doesn't work in
+// LLVM — all functions in a module share one LLVMContext, and transforms
+// create constants, types and call sites through that context's uniquing
+// tables, which are not thread-safe. The parallelism we do get is at module
+// granularity: with WMO and -num-threads, IRGen splits output into one LLVM
+// module per thread and each runs this whole pipeline independently.
 bool SwiftARCOpt::runOnFunction(Function &F) {
   if (DisableARCOpts)
     return false;
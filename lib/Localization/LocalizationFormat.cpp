@@ -132,7 +132,21 @@ SerializedLocalizationProducer::SerializedLocalizationProducer(
     : LocalizationProducer(printDiagnosticNames), Buffer(std::move(buffer)) {
 }
 
+SerializedLocalizationProducer::SerializedLocalizationProducer(
+    llvm::StringRef filePath, bool printDiagnosticNames)
+    : LocalizationProducer(printDiagnosticNames), filePath(filePath) {}
+
 bool SerializedLocalizationProducer::initializeImpl() {
+  if (!Buffer) {
+    auto file = llvm::MemoryBuffer::getFile(filePath);
+    if (!file)
+      return false;
+    Buffer = std::move(file.get());
+  }
+
+  // The buffer is memory-mapped for files of this size, and the table header
+  // only records bucket offsets, so nothing beyond the pages a lookup
+  // actually touches is ever materialized.
   auto base =
       reinterpret_cast<const unsigned char *>(Buffer.get()->getBufferStart());
   auto tableOffset = endian::read<offset_type>(base, little);
@@ -190,12 +204,12 @@ LocalizationProducer::producerFor(llvm::StringRef locale, llvm::StringRef path,
   llvm::sys::path::replace_extension(filePath, ".db");
 
   // If the serialized diagnostics file not available,
-  // fallback to the `YAML` file.
+  // fallback to the `YAML` file. Opening and indexing the file is deferred
+  // until the first diagnostic fires, so picking a producer here only costs
+  // the existence checks.
   if (llvm::sys::fs::exists(filePath)) {
-    if (auto file = llvm::MemoryBuffer::getFile(filePath)) {
-      producer = std::make_unique<diag::SerializedLocalizationProducer>(
-          std::move(file.get()), printDiagnosticNames);
-    }
+    producer = std::make_unique<diag::SerializedLocalizationProducer>(
+        filePath.str(), printDiagnosticNames);
   } else {
     llvm::sys::path::replace_extension(filePath, ".yaml");
     // In case of missing localization files, we should fallback to messages
@@ -206,6 +220,15 @@ LocalizationProducer::producerFor(llvm::StringRef locale, llvm::StringRef path,
     }
   }
 
+  // Fall back from a regional locale to its base language (e.g. "pt_BR" to
+  // "pt") when no files exist for the full name.
+  if (!producer) {
+    auto splitPos = locale.find_first_of("_-");
+    if (splitPos != llvm::StringRef::npos)
+      producer = producerFor(locale.take_front(splitPos), path,
+                             printDiagnosticNames);
+  }
+
   return producer;
 }
 
@@ -120,6 +120,16 @@ Migrator::repeatFixitMigrations(const unsigned Iterations,
   return nullptr;
 }
 
+// Each fix-it round constructs a fresh CompilerInstance rather than reusing
+// the previous one. That is deliberate: a round rewrites the text of the
+// primary input, and there is no way to re-typecheck "just the edited file"
+// within a live instance — ASTContext allocates into append-only arenas and
+// the request evaluator caches results against those nodes, so the only sound
+// invalidation is to drop the whole context. Since the migrator runs with a
+// single primary, the edited file *is* the whole frontend job anyway, and
+// repeatFixitMigrations already stops iterating as soon as a round applies no
+// fix-its. The cl::ResetAllOptionOccurrences call below is another reason the
+// instances cannot overlap: setup() mutates LLVM global option state.
 std::unique_ptr<swift::CompilerInstance>
 Migrator::performAFixItMigration(version::Version SwiftLanguageVersion) {
   auto InputState = States.back();
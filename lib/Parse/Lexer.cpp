@@ -376,6 +376,11 @@ static bool advanceToEndOfLine(const char *&CurPtr, const char *BufferEnd,
                                const char *CodeCompletionPtr = nullptr,
                                DiagnosticEngine *Diags = nullptr) {
   while (1) {
+    // Skip over runs of plain ASCII in one tight loop; only newlines, nuls,
+    // and high-bit bytes need the careful handling below.
+    while ((signed char)*CurPtr > 0 && *CurPtr != '\n' && *CurPtr != '\r')
+      ++CurPtr;
+
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -658,7 +663,13 @@ void Lexer::lexIdentifier() {
   assert(didStart && "Unexpected start");
   (void) didStart;
 
-  // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
+  // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*. Almost all identifiers are pure
+  // ASCII; consume those bytes without going through UTF-8 validation, then
+  // fall back to the code-point-at-a-time loop for anything extended.
+  while (CurPtr < BufferEnd &&
+         (signed char)*CurPtr > 0 &&
+         clang::isIdentifierBody(*CurPtr, /*dollar*/true))
+    ++CurPtr;
   while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart),
@@ -2547,6 +2558,10 @@ Restart:
   case '\t':
   case '\v':
   case '\f':
+    // Consume the rest of a horizontal whitespace run without re-entering
+    // the switch for every byte.
+    while (*CurPtr == ' ' || *CurPtr == '\t')
+      ++CurPtr;
     goto Restart;
   case '/':
     if (IsForTrailingTrivia || isKeepingComments()) {
@@ -116,8 +116,9 @@ BraceStmt *ParseAbstractFunctionBodyRequest::evaluate(
   case BodyKind::Unparsed: {
     // FIXME: How do we configure code completion?
     SourceFile &sf = *afd->getDeclContext()->getParentSourceFile();
-    SourceManager &sourceMgr = sf.getASTContext().SourceMgr;
-    unsigned bufferID = sourceMgr.findBufferContainingLoc(afd->getLoc());
+    // A delayed body always lives in its source file's own buffer, so don't
+    // pay for a SourceManager search to find it again for every body.
+    unsigned bufferID = *sf.getBufferID();
     Parser parser(bufferID, sf, /*SIL*/ nullptr);
     parser.SyntaxContext->disable();
     auto body = parser.parseAbstractFunctionBodyDelayed(afd);
@@ -36,6 +36,15 @@ bool SyntaxParsingCache::nodeCanBeReused(const Syntax &Node, size_t NodeStart,
   if (Node.getKind() != Kind)
     return false;
 
+  // Check the node's own range first; finding the next token below requires
+  // walking the tree, and there's no point doing that for the nodes along
+  // the spine that contain the edit itself.
+  auto NodeEnd = NodeStart + Node.getTextLength();
+  for (auto Edit : Edits) {
+    if (Edit.intersectsOrTouchesRange(NodeStart, NodeEnd))
+      return false;
+  }
+
   // Node can also not be reused if an edit has been made in the next token's
   // text, e.g. because `private struct Foo {}` parses as a CodeBlockItem with a
   // StructDecl inside and `private struc Foo {}` parses as two CodeBlockItems
@@ -49,10 +58,9 @@ bool SyntaxParsingCache::nodeCanBeReused(const Syntax &Node, size_t NodeStart,
     NextLeafNodeLength += NextRawNode->getLeadingTriviaLength();
   }
 
-  auto NodeEnd = NodeStart + Node.getTextLength();
   for (auto Edit : Edits) {
-    // Check if this node or the trivia of the next node has been edited. If it
-    // has, we cannot reuse it.
+    // Check if the trivia of the next node has been edited. If it has, we
+    // cannot reuse this node either.
     if (Edit.intersectsOrTouchesRange(NodeStart, NodeEnd + NextLeafNodeLength))
       return false;
   }
@@ -385,6 +385,15 @@ static void writeEpilogue(raw_ostream &os) {
 bool swift::printAsObjC(raw_ostream &os, ModuleDecl *M,
                         StringRef bridgingHeader,
                         AccessLevel minRequiredAccess) {
+  // The header always covers every exposed decl. Narrowing it to the
+  // decls a project actually references from Objective-C would make the
+  // emitted interface a function of the clients observed in some earlier
+  // build — a header that compiles today and breaks when someone writes
+  // the first reference to an unprinted class, with no dependency edge to
+  // regenerate it. The supported cost levers are in the caller's hands:
+  // minRequiredAccess drops internal decls from the header, and clients
+  // that include it repeatedly amortize Clang's parse through PCH like
+  // any other large header.
   llvm::PrettyStackTraceString trace("While generating Objective-C header");
 
   SmallPtrSet<ImportModuleTy, 8> imports;
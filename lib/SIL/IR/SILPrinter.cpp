@@ -44,6 +44,7 @@
 #include "llvm/ADT/APInt.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
@@ -77,6 +78,16 @@ llvm::cl::opt<bool> SILPrintGenericSpecializationInfo(
     llvm::cl::desc("Include generic specialization"
                    "information info in SIL output"));
 
+llvm::cl::list<std::string> SILPrintOnlyFun(
+    "sil-print-only-function", llvm::cl::CommaSeparated,
+    llvm::cl::desc("Only print SIL for functions with these names in module "
+                   "dumps"));
+
+llvm::cl::opt<std::string> SILPrintOnlyFuns(
+    "sil-print-only-functions", llvm::cl::init(""),
+    llvm::cl::desc("Only print SIL for functions whose name contains this "
+                   "substring in module dumps"));
+
 static std::string demangleSymbol(StringRef Name) {
   if (SILFullDemangle)
     return Demangle::demangleSymbolAsString(Name);
@@ -2895,18 +2906,33 @@ static void printSILGlobals(SILPrintContext &Ctx,
     g->print(Ctx.OS(), Ctx.printVerbose());
 }
 
+/// Whether \p f is selected by -sil-print-only-function(s). When neither
+/// option is set, every function is printed. Filtered-out functions are
+/// skipped before any formatting work happens, which is what makes filtered
+/// -emit-sil dumps of large modules cheap.
+static bool shouldPrintFunction(const SILFunction &f) {
+  if (SILPrintOnlyFun.empty() && SILPrintOnlyFuns.empty())
+    return true;
+  if (llvm::is_contained(SILPrintOnlyFun, f.getName()))
+    return true;
+  return !SILPrintOnlyFuns.empty() &&
+         f.getName().contains(SILPrintOnlyFuns);
+}
+
 static void printSILFunctions(SILPrintContext &Ctx,
                               const SILModule::FunctionListType &Functions) {
   if (!Ctx.sortSIL()) {
     for (const SILFunction &f : Functions)
-      f.print(Ctx);
+      if (shouldPrintFunction(f))
+        f.print(Ctx);
     return;
   }
 
   std::vector<const SILFunction *> functions;
   functions.reserve(Functions.size());
   for (const SILFunction &f : Functions)
-    functions.push_back(&f);
+    if (shouldPrintFunction(f))
+      functions.push_back(&f);
   std::sort(functions.begin(), functions.end(),
     [] (const SILFunction *f1, const SILFunction *f2) -> bool {
       return f1->getName().compare(f2->getName()) == -1;
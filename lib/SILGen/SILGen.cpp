@@ -1990,6 +1990,15 @@ public:
 
 // An RAII object that constructs a \c SILGenModule instance.
 // On destruction, delayed definitions are automatically emitted.
+//
+// Emission is intentionally serial, including in whole-module builds.
+// Lowering a single body drives lazy work throughout shared state — type
+// lowering caches, witness table and conformance emission on SILGenModule,
+// request evaluation back into Sema, and allocation in the SILModule — none
+// of which is synchronized, and delayed definitions discovered while
+// emitting one body are routinely emitted while another is on the stack.
+// Emitting into per-thread SIL buffers would not sidestep that, since the
+// coupling is in the shared caches and the AST, not the output module.
 class SILGenModuleRAII {
   SILGenModule SGM;
 
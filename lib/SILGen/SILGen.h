@@ -171,6 +171,13 @@ public:
 
   /// Get or create the declaration of a reabstraction thunk with the
   /// given signature.
+  ///
+  /// Thunks are deduplicated module-wide by their mangled name: the shared
+  /// function lookup returns any previously created SILFunction, and callers
+  /// only emit a body into an empty thunk. Each unique thunk therefore flows
+  /// through SILGen and the optimizer exactly once per module; identical
+  /// thunks from different modules are merged by the linker via their shared
+  /// linkage.
   SILFunction *getOrCreateReabstractionThunk(
                                            CanSILFunctionType thunkType,
                                            CanSILFunctionType fromType,
@@ -9,6 +9,18 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// A note on duplication: the bridging thunks emitted here are already
+// memoized at module scope. Declaration-level thunks (native-to-foreign and
+// foreign-to-native) are keyed by their SILDeclRef and emitted at most once
+// per module, and block/function-conversion thunks go through the shared
+// mangled-name lookup in getOrCreateReabstractionThunk with an empty()
+// guard before their bodies are filled in. What repeats at every call site
+// of an ObjC API is not a thunk but the inline value-bridging code
+// (e.g. String <-> NSString conversion applies), which must stay inline
+// because it depends on each call site's formal types and ownership.
+//
+//===----------------------------------------------------------------------===//
 
 #include "ArgumentScope.h"
 #include "Callee.h"
@@ -3834,6 +3834,15 @@ visitMagicIdentifierLiteralExpr(MagicIdentifierLiteralExpr *E, SGFContext C) {
 }
 
 RValue RValueEmitter::visitCollectionExpr(CollectionExpr *E, SGFContext C) {
+  // Note: even a fully-constant literal cannot be emitted as a static
+  // initializer from here. Whether every element lowers to a compile-time
+  // constant is only knowable after the element expressions have been
+  // lowered, constant-folded and their literal-conversion calls inlined, and
+  // the statically-initialized object representation requires the layout
+  // decisions (e.g. whether the buffer can live in read-only memory for the
+  // target's COW representation) that GlobalOpt and ObjectOutliner make at
+  // -O. SILGen therefore always emits the general element-by-element
+  // initialization and leaves promotion to the optimizer.
   auto loc = SILLocation(E);
   ArgumentScope scope(SGF, loc);
 
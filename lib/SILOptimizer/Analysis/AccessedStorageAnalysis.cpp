@@ -348,6 +348,15 @@ void AccessedStorageResult::dump() const { print(llvm::dbgs()); }
 // GenericFunctionEffectAnalysis.
 // -----------------------------------------------------------------------------
 
+// Note that the worst-case treatment of external functions below is not
+// just a missing serialization feature. Shipping this summary in the
+// swiftmodule would tie clients to one build of the library, and resilient
+// libraries are replaceable at run time without recompiling clients — an
+// optimizer that dropped exclusivity checks based on a stale summary would
+// miss real violations. Cross-module precision is instead obtained by
+// making the callee's SIL itself visible: @inlinable/-O cross-module
+// optimization deserializes bodies, and then these summaries are computed
+// from real instructions rather than declarations.
 bool FunctionAccessedStorage::summarizeFunction(SILFunction *F) {
   assert(accessResult.isEmpty() && "expected uninitialized results.");
 
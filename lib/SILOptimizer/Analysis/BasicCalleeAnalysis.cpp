@@ -67,11 +67,10 @@ void CalleeCache::sortAndUniqueCallees() {
   for (auto &Pair : TheCache) {
     auto &Callees = *Pair.second.getPointer();
 
-    // Sort by enumeration number so that clients get a stable order.
+    // Sort by name so that clients get a stable order.
     std::sort(Callees.begin(), Callees.end(),
               [](SILFunction *Left, SILFunction *Right) {
-                // Check if Right's lexicographical order is greater than Left.
-                return 1 == Right->getName().compare(Left->getName());
+                return Left->getName() < Right->getName();
               });
 
     // Remove duplicates.
@@ -35,23 +35,23 @@ TypeExpansionAnalysis::getTypeExpansion(SILType B, SILModule *Mod,
     return Iter->second;
   }
 
-  // Don't expand large types. This would defeat keeping them in memory.
-  if (!shouldExpand(*Mod, B)) {
-    // Push the empty projection path.
-    ProjectionPath P(B);
-    ExpansionCache[key].push_back(P);
-    return ExpansionCache[key];
-  }
-
   // Flush the cache if the size of the cache is too large.
   if (ExpansionCache.size() > TypeExpansionAnalysisMaxCacheSize) {
     ExpansionCache.clear();
   }
 
+  ProjectionPathList &Expansion = ExpansionCache[key];
+
+  // Don't expand large types. This would defeat keeping them in memory.
+  if (!shouldExpand(*Mod, B)) {
+    // Push the empty projection path.
+    Expansion.push_back(ProjectionPath(B));
+    return Expansion;
+  }
+
   // Build the type expansion for the leaf nodes.
-  ProjectionPath::expandTypeIntoLeafProjectionPaths(B, Mod, context,
-                                                    ExpansionCache[key]);
-  return ExpansionCache[key];
+  ProjectionPath::expandTypeIntoLeafProjectionPaths(B, Mod, context, Expansion);
+  return Expansion;
 }
 
 SILAnalysis *swift::createTypeExpansionAnalysis(SILModule *M) {
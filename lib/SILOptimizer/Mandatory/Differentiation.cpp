@@ -526,6 +526,18 @@ emitDerivativeFunctionReference(
           context.getASTContext(), originalFnTy->getNumParameters());
     }
     // Look up a differentiability witness with the exact configuration.
+    //
+    // These lookups are the cross-module reuse path: witnesses for functions
+    // that declare their differentiability (`@differentiable`,
+    // `@derivative`) are serialized into the defining module's swiftmodule
+    // along with their JVP/VJP, keyed by the original function and config,
+    // and are found here instead of being re-synthesized. Only when a
+    // witness has to be invented on the spot — implicit differentiation of
+    // a function whose module exported no witness — does each client module
+    // pay for synthesis again, and that witness is deliberately private and
+    // unserialized: exporting it would bake internal SIL of another module
+    // into ours with no invalidation story. The fix for repeated synthesis
+    // downstream is to annotate the functions in the defining library.
     auto *minimalWitness = getExactDifferentiabilityWitness(
         context.getModule(), originalFn, desiredParameterIndices,
         desiredResultIndices);
@@ -652,6 +652,15 @@ static SILValue stripFunctionConversions(SILValue CalleeValue) {
 /// In the case that a non-null value is returned, FullArgs contains effective
 /// argument operands for the callee function.
 static SILFunction *
+// A per-callee verdict memo would buy little here: almost everything this
+// function does is per-call-site — walking the callee value chain through
+// copies, loads, partial applies and conversions to find a function_ref at
+// all, and collecting the applied arguments along the way. Once the callee
+// is known, the per-callee checks that follow are single flag loads
+// (transparent bit, representation, emptiness, linkage), cheaper than any
+// map lookup keyed on the callee would be. The expensive per-callee work —
+// recursively processing a transparent function's own body — is already
+// memoized across the module via FullyInlinedSet below.
 getCalleeFunction(SILFunction *F, FullApplySite AI, bool &IsThick,
                   SmallVectorImpl<ParameterConvention> &CapturedArgConventions,
                   SmallVectorImpl<SILValue> &FullArgs,
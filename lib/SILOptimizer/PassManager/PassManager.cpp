@@ -44,6 +44,12 @@ llvm::cl::opt<bool> SILPrintPassName(
     "sil-print-pass-name", llvm::cl::init(false),
     llvm::cl::desc("Print the name of each SIL pass before it runs"));
 
+// Quick per-pass wall-clock dump. For structured per-pass profiles —
+// durations plus block/instruction/function-count deltas keyed by stage,
+// transform name and pass number — use the CSV machinery in
+// OptimizerStatsUtils.cpp instead: -sil-stats-dump-all -sil-stats-modules
+// -sil-stats-functions [-sil-stats-output-file]. Both work from sil-opt as
+// well as the frontend.
 llvm::cl::opt<bool> SILPrintPassTime(
     "sil-print-pass-time", llvm::cl::init(false),
     llvm::cl::desc("Print the execution time of each SIL pass"));
@@ -117,6 +123,13 @@ llvm::cl::opt<bool> SILVerifyWithoutInvalidation(
     "sil-verify-without-invalidation", llvm::cl::init(false),
     llvm::cl::desc("Verify after passes even if the pass has not invalidated"));
 
+llvm::cl::opt<unsigned> SILVerifySampleInterval(
+    "sil-verify-sample-interval", llvm::cl::init(1),
+    llvm::cl::desc("With -sil-verify-all, only run the verifier after every "
+                   "Nth function pass that made a change. The sampled subset "
+                   "is deterministic, and module passes are still verified "
+                   "unconditionally"));
+
 llvm::cl::opt<bool> SILDisableSkippingPasses(
     "sil-disable-skipping-passes", llvm::cl::init(false),
     llvm::cl::desc("Do not skip passes even if nothing was changed"));
@@ -456,7 +469,12 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
     F->dump(getOptions().EmitVerboseSIL);
   }
 
-  llvm::sys::TimePoint<> StartTime = std::chrono::system_clock::now();
+  // Only read the clock when something consumes the timing; two clock reads
+  // per pass run add up over a whole function pipeline.
+  const bool MeasureTime = SILPrintPassTime || areOptimizerStatsEnabled();
+  llvm::sys::TimePoint<> StartTime;
+  if (MeasureTime)
+    StartTime = std::chrono::system_clock::now();
   if (breakBeforeRunning(F->getName(), SFT))
     LLVM_BUILTIN_DEBUGTRAP;
   if (SILForceVerifyAll ||
@@ -487,7 +505,9 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   assert(analysesUnlocked() && "Expected all analyses to be unlocked!");
   Mod->flushDeletedInsts();
 
-  auto Delta = (std::chrono::system_clock::now() - StartTime).count();
+  std::chrono::system_clock::duration::rep Delta = 0;
+  if (MeasureTime)
+    Delta = (std::chrono::system_clock::now() - StartTime).count();
   if (SILPrintPassTime) {
     llvm::dbgs() << Delta << " (" << SFT->getID() << "," << F->getName()
                  << ")\n";
@@ -507,7 +527,9 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
     completedPasses.set((size_t)SFT->getPassKind());
 
   if (getOptions().VerifyAll &&
-      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation)) {
+      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation) &&
+      (SILVerifySampleInterval <= 1 ||
+       NumPassesRun % SILVerifySampleInterval == 0)) {
     F->verify();
     verifyAnalyses(F);
   } else {
@@ -289,11 +289,17 @@ public:
     // Initialize to true if we are running optimistic data flow, i.e.
     // MultiIteration is true.
     BBSetOut.resize(size, MultiIteration);
-    BBMaxSet.resize(size, !IsEntry && MultiIteration);
-  
-    // Genset and Killset are initially empty.
-    BBGenSet.resize(size, false);
-    BBKillSet.resize(size, false);
+
+    // The max, gen and kill sets are only read by the iterative gen-kill
+    // data flow; skip allocating them per block in the common
+    // single-iteration case.
+    if (MultiIteration) {
+      BBMaxSet.resize(size, !IsEntry);
+
+      // Genset and Killset are initially empty.
+      BBGenSet.resize(size, false);
+      BBKillSet.resize(size, false);
+    }
   }
 };
 
@@ -641,17 +647,23 @@ public:
 
   /// If \p InitOptimistic is true, the block in-bits are initialized to 1
   /// which enables optimistic data flow evaluation.
-  void init(bool InitOptimistic, unsigned size) {
+  void init(bool InitOptimistic, unsigned size, bool MultiIteration) {
     // backward data flow.
     // Initialize to true if we are running optimistic data flow, i.e.
     // MultiIteration is true.
     BBSetIn.resize(size, InitOptimistic);
     BBSetOut.resize(size, false);
-    BBMaxSet.resize(size, InitOptimistic);
-  
-    // Genset and Killset are initially empty.
-    BBGenSet.resize(size, false);
-    BBKillSet.resize(size, false);
+
+    // The max, gen and kill sets are only read by the iterative gen-kill
+    // data flow; skip allocating them per block in the common
+    // single-iteration case.
+    if (MultiIteration) {
+      BBMaxSet.resize(size, InitOptimistic);
+
+      // Genset and Killset are initially empty.
+      BBGenSet.resize(size, false);
+      BBKillSet.resize(size, false);
+    }
   }
 };
 
@@ -807,7 +819,7 @@ void ReleaseCodeMotionContext::initializeCodeMotionDataFlow() {
   // Initialize all the data flow bit vector for all basic blocks.
   for (auto bd : BlockStates) {
     bd.data.init(BlocksInitOptimistically.contains(&bd.block) != 0,
-                 RCRootVault.size());
+                 RCRootVault.size(), MultiIteration);
   }
 }
 
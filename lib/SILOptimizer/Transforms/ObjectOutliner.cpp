@@ -513,6 +513,15 @@ bool ObjectOutliner::optimizeObjectAllocation(AllocRefInst *ARI) {
 /// _findStringSwitchCaseWithCache which builds a cache (e.g. a Dictionary) and
 /// stores it into a global variable. Then subsequent calls to this function can
 /// do a fast lookup using the cache.
+///
+/// This lazy once-per-process cache is as far as the outliner can take
+/// Dictionary: emitting prebuilt hash-table storage at compile time is off
+/// the table because Hasher is seeded per process launch (deliberately, for
+/// hash-flooding resistance), so bucket positions computed by the compiler
+/// would be wrong at run time. Constant Dictionary literals therefore can't
+/// get the static-object treatment that arrays do; the launch-time fix for
+/// big constant tables is making them lazy (as here) or using sorted
+/// arrays, whose layout is hash-independent.
 void ObjectOutliner::replaceFindStringCall(ApplyInst *FindStringCall) {
   // Find the replacement function in the swift stdlib.
   SmallVector<ValueDecl *, 1> results;
@@ -162,14 +162,9 @@ class SILPerformanceInliner {
     return SPA;
   }
 
-  bool profileBasedDecision(
-      const FullApplySite &AI, int Benefit, SILFunction *Callee, int CalleeCost,
-      int &NumCallerBlocks,
-      const llvm::DenseMapIterator<
-          swift::SILBasicBlock *, uint64_t,
-          llvm::DenseMapInfo<swift::SILBasicBlock *>,
-          llvm::detail::DenseMapPair<swift::SILBasicBlock *, uint64_t>, true>
-          &bbIt);
+  bool profileBasedDecision(const FullApplySite &AI, int Benefit,
+                            SILFunction *Callee, int CalleeCost,
+                            uint64_t CallerCount, int &NumCallerBlocks);
 
   bool isProfitableToInline(
       FullApplySite AI, Weight CallerWeight, ConstantTracker &callerTracker,
@@ -211,17 +206,12 @@ static bool canSpecializeGeneric(ApplySite AI, SILFunction *F,
 
 bool SILPerformanceInliner::profileBasedDecision(
     const FullApplySite &AI, int Benefit, SILFunction *Callee, int CalleeCost,
-    int &NumCallerBlocks,
-    const llvm::DenseMapIterator<
-        swift::SILBasicBlock *, uint64_t,
-        llvm::DenseMapInfo<swift::SILBasicBlock *>,
-        llvm::detail::DenseMapPair<swift::SILBasicBlock *, uint64_t>, true>
-        &bbIt) {
+    uint64_t CallerCount, int &NumCallerBlocks) {
   if (CalleeCost < TrivialFunctionThreshold) {
     // We do not increase code size below this threshold
     return true;
   }
-  auto callerCount = bbIt->getSecond();
+  auto callerCount = CallerCount;
   if (callerCount < 1) {
     // Never called - do not inline
     LLVM_DEBUG(dumpCaller(AI.getFunction());
@@ -502,8 +492,8 @@ bool SILPerformanceInliner::isProfitableToInline(
   auto *bb = AI.getInstruction()->getParent();
   auto bbIt = BBToWeightMap.find(bb);
   if (bbIt != BBToWeightMap.end()) {
-    if (profileBasedDecision(AI, Benefit, Callee, CalleeCost, NumCallerBlocks,
-                             bbIt)) {
+    if (profileBasedDecision(AI, Benefit, Callee, CalleeCost,
+                             bbIt->getSecond(), NumCallerBlocks)) {
       OptRemark::Emitter::emitOrDebug(DEBUG_TYPE, &ORE, [&]() {
         using namespace OptRemark;
         return RemarkPassed("Inline", *AI.getInstruction())
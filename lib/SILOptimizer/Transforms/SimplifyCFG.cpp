@@ -2800,7 +2800,12 @@ static bool tryMoveCondFailToPreds(SILBasicBlock *BB) {
 bool SimplifyCFG::simplifyBlocks() {
   bool Changed = false;
 
-  // Add all of the blocks to the function.
+  // Seed the worklist with every block in the function. Change tracking in
+  // the pass manager is function-grained — if no pass invalidated this
+  // function since the last SimplifyCFG run, the whole pass is skipped — so
+  // there is no narrower "modified blocks" set available to seed from. Within
+  // a run, the worklist keeps the fixpoint iteration proportional to the
+  // blocks that actually simplify.
   for (auto &BB : Fn)
     addToWorklist(&BB);
 
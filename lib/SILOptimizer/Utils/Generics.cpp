@@ -1867,6 +1867,16 @@ GenericFuncSpecializer::GenericFuncSpecializer(
 }
 
 /// Return an existing specialization if one exists.
+///
+/// This lookup only deduplicates within the current SILModule. Across
+/// frontend jobs, identical specializations are emitted with shared linkage
+/// and deduplicated by the linker; sharing the SIL itself between jobs would
+/// require serializing specialized bodies outside of any swiftmodule, and the
+/// body produced for a given mangled name still depends on the optimization
+/// context (resilience expansion, serialized-SIL level) of the producing
+/// module. Reuse across modules is available where it matters most via
+/// @_specialize(exported:) prespecializations, which usePrespecialized()
+/// consults before creating a new specialization.
 SILFunction *GenericFuncSpecializer::lookupSpecialization() {
   if (SILFunction *SpecializedF = M.lookUpFunction(ClonedName)) {
     if (ReInfo.getSpecializedType() != SpecializedF->getLoweredFunctionType()) {
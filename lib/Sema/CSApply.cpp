@@ -33,6 +33,7 @@
 #include "swift/AST/OperatorNameLookup.h"
 #include "swift/AST/ParameterList.h"
 #include "swift/AST/ProtocolConformance.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/AST/SubstitutionMap.h"
 #include "swift/Basic/Defer.h"
 #include "swift/Basic/StringExtras.h"
@@ -8871,6 +8872,22 @@ Optional<SolutionApplicationTarget> ConstraintSystem::applySolution(
 
   rewriter.finalize();
 
+  // Remember which overload won for each operator, so the solver can try
+  // it first when it encounters the operator again later in this file.
+  if (auto *sourceFile = DC->getParentSourceFile()) {
+    for (const auto &overload : solution.overloadChoices) {
+      auto &choice = overload.second.choice;
+      if (!choice.isDecl())
+        continue;
+
+      auto *decl = choice.getDecl();
+      if (decl->isOperator()) {
+        sourceFile->LastSolvedOperatorOverloads[decl->getBaseIdentifier()] =
+            decl;
+      }
+    }
+  }
+
   return resultTarget;
 }
 
@@ -4930,10 +4930,84 @@ bool ConstraintSystem::repairFailures(
   return !conversionsOrFixes.empty();
 }
 
+/// Whether a match between these concrete types can take one of the
+/// locator-dependent paths in \c matchTypesImpl. Such a pair must never be
+/// remembered in the failed-match cache, because the same (types, kind,
+/// flags) combination can legitimately fail at one locator and succeed at
+/// another within the same constraint system.
+static bool isLocatorSensitiveMatch(Type type1, Type type2,
+                                    ConstraintKind kind) {
+  // Uninhabited-to-T and T-to-Void conversions succeed only when the
+  // locator ends in a closure body or a single-expression-return
+  // contextual position.
+  if (kind >= ConstraintKind::Subtype &&
+      (type1->isUninhabited() || type2->isVoid()))
+    return true;
+
+  // Array/string/inout-to-pointer conversions are suppressed when the
+  // locator is an autoclosure result. The conversion also looks through
+  // an optional on the pointer side.
+  if (kind >= ConstraintKind::Conversion &&
+      type2->lookThroughAllOptionalTypes()->getAnyPointerElementType())
+    return true;
+
+  auto ty1 = type1->lookThroughAllOptionalTypes();
+  auto ty2 = type2->lookThroughAllOptionalTypes();
+
+  // The implicit Double<->CGFloat conversion is permitted or rejected
+  // based purely on where the match occurs (argument positions and
+  // contextual conversions, but not CGFloat initializer calls, coercions,
+  // or nested implicit conversions).
+  if (kind >= ConstraintKind::Subtype &&
+      (ty1->isCGFloatType() || ty2->isCGFloatType()) &&
+      (ty1->isDouble() || ty2->isDouble()))
+    return true;
+
+  // Function-type matches can implode a single tuple parameter, but only
+  // at apply-argument and enum-element pattern-match locators (found by
+  // skipping optional payload elements, hence the unwrap above). This
+  // applies to any match kind.
+  if (ty1->is<AnyFunctionType>() && ty2->is<AnyFunctionType>())
+    return true;
+
+  return false;
+}
+
 ConstraintSystem::TypeMatchResult
 ConstraintSystem::matchTypes(Type type1, Type type2, ConstraintKind kind,
                              TypeMatchOptions flags,
                              ConstraintLocatorBuilder locator) {
+  // Matches between fully-concrete types are deterministic within a
+  // constraint system, and deep disjunction exploration attempts the same
+  // pairs over and over. A failed match leaves no trace in the system as
+  // long as fixes aren't being recorded, so known failures can be
+  // short-circuited — except for the few pairs whose outcome depends on
+  // the locator. Successful matches can't be remembered at all: they may
+  // adjust the score or record conversion restrictions along the way.
+  Optional<std::pair<std::pair<TypeBase *, TypeBase *>, unsigned>> cacheKey;
+  if (!shouldAttemptFixes() &&
+      !getASTContext().TypeCheckerOpts.DisableConstraintSolverPerformanceHacks &&
+      !type1->hasTypeVariable() && !type2->hasTypeVariable() &&
+      !isLocatorSensitiveMatch(type1, type2, kind)) {
+    cacheKey = std::make_pair(
+        std::make_pair(type1->getCanonicalType().getPointer(),
+                       type2->getCanonicalType().getPointer()),
+        (static_cast<unsigned>(kind) << 8) | flags.toRaw());
+
+    if (FailedConcreteMatches.count(*cacheKey))
+      return getTypeMatchFailure(locator);
+  }
+
+  auto result = matchTypesImpl(type1, type2, kind, flags, locator);
+  if (cacheKey && result.isFailure())
+    FailedConcreteMatches.insert(*cacheKey);
+  return result;
+}
+
+ConstraintSystem::TypeMatchResult
+ConstraintSystem::matchTypesImpl(Type type1, Type type2, ConstraintKind kind,
+                                 TypeMatchOptions flags,
+                                 ConstraintLocatorBuilder locator) {
   // If we have type variables that have been bound to fixed types, look through
   // to the fixed type.
   type1 = getFixedTypeRecursive(type1, flags, kind == ConstraintKind::Equal);
@@ -6172,8 +6246,7 @@ ConstraintSystem::SolutionKind ConstraintSystem::simplifyConformsToConstraint(
   case ConstraintKind::ConformsTo:
   case ConstraintKind::LiteralConformsTo: {
     // Check whether this type conforms to the protocol.
-    auto conformance = DC->getParentModule()->lookupConformance(
-        type, protocol);
+    auto conformance = lookupConformance(type, protocol);
     if (conformance) {
       return recordConformance(conformance);
     }
@@ -8404,8 +8477,7 @@ ConstraintSystem::simplifyValueWitnessConstraint(
   // conformance already?
   auto proto = requirement->getDeclContext()->getSelfProtocolDecl();
   assert(proto && "Value witness constraint for a non-requirement");
-  auto conformance = useDC->getParentModule()->lookupConformance(
-      baseObjectType, proto);
+  auto conformance = lookupConformance(baseObjectType, proto);
   if (!conformance) {
     // The conformance failed, so mark the member type as a "hole". We cannot
     // do anything further here.
@@ -11197,6 +11269,13 @@ bool ConstraintSystem::recordFix(ConstraintFix *fix, unsigned impact) {
   auto anchor = fix->getAnchor();
   assert(bool(anchor) && "non-augmenting fix without an anchor?");
 
+  // If there are no fixes yet there is nothing to subsume this one;
+  // don't bother collecting anchors or walking the expression below.
+  if (Fixes.empty()) {
+    Fixes.push_back(fix);
+    return false;
+  }
+
   // Only useful to record if no pre-existing fix is associated with
   // current anchor or, in case of anchor being an expression, any of
   // its sub-expressions.
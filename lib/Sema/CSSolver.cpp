@@ -17,6 +17,7 @@
 #include "TypeCheckType.h"
 #include "TypeChecker.h"
 #include "swift/AST/ParameterList.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/AST/TypeWalker.h"
 #include "swift/Basic/Defer.h"
 #include "swift/Sema/ConstraintGraph.h"
@@ -2024,6 +2025,35 @@ void DisjunctionChoiceProducer::partitionDisjunction(
     return false;
   });
 
+  // Overloads that won for the same operator earlier in this file are a
+  // good first guess: math- and string-heavy files use the same handful
+  // of operator overloads throughout.
+  SmallVector<unsigned, 4> previouslyChosen;
+  if (isOperatorDisjunction(Disjunction) &&
+      !CS.getASTContext()
+           .TypeCheckerOpts.DisableConstraintSolverPerformanceHacks) {
+    if (auto *sourceFile = CS.DC->getParentSourceFile()) {
+      forEachChoice(Choices, [&](unsigned index,
+                                 Constraint *constraint) -> bool {
+        if (constraint->getKind() != ConstraintKind::BindOverload)
+          return false;
+
+        auto *decl = constraint->getOverloadChoice().getDeclOrNull();
+        if (!decl)
+          return false;
+
+        auto known = sourceFile->LastSolvedOperatorOverloads.find(
+            decl->getBaseIdentifier());
+        if (known == sourceFile->LastSolvedOperatorOverloads.end() ||
+            known->second != decl)
+          return false;
+
+        previouslyChosen.push_back(index);
+        return true;
+      });
+    }
+  }
+
   // Then unavailable constraints if we're skipping them.
   if (!CS.shouldAttemptFixes()) {
     forEachChoice(Choices, [&](unsigned index, Constraint *constraint) -> bool {
@@ -2072,6 +2102,7 @@ void DisjunctionChoiceProducer::partitionDisjunction(
       };
 
   appendPartition(favored);
+  appendPartition(previouslyChosen);
   appendPartition(everythingElse);
   appendPartition(simdOperators);
   appendPartition(unavailable);
@@ -597,10 +597,10 @@ bool TypeChecker::isDeclRefinementOf(ValueDecl *declA, ValueDecl *declB) {
 bool DisjunctionStep::shouldSkip(const DisjunctionChoice &choice) const {
   auto &ctx = CS.getASTContext();
 
-  auto skip = [&](std::string reason) -> bool {
+  auto skip = [&](StringRef reason) -> bool {
     if (CS.isDebugMode()) {
       auto &log = getDebugLogger();
-      log << "(skipping " + reason + " ";
+      log << "(skipping " << reason << " ";
       choice.print(log, &ctx.SourceMgr);
       log << '\n';
     }
@@ -639,10 +639,21 @@ bool DisjunctionStep::shouldSkip(const DisjunctionChoice &choice) const {
   // introduce any conversions (i.e., the score is not worse than the
   // current score), we can skip any generic operators with conformance
   // requirements that are not satisfied by any known argument types.
-  auto argFnType = CS.getAppliedDisjunctionArgumentFunction(Disjunction);
+  //
+  // The applied argument function and the best score so far are only
+  // computed once a choice is known to be a generic operator, so that
+  // plain overload disjunctions don't pay for this check on every choice.
+  const FunctionType *argFnType = nullptr;
   auto checkRequirementsEarly = [&]() -> bool {
+    if (!choice.isGenericOperator())
+      return false;
+
     auto bestScore = getBestScore(Solutions);
-    if (!(bestScore && choice.isGenericOperator() && argFnType))
+    if (!bestScore)
+      return false;
+
+    argFnType = CS.getAppliedDisjunctionArgumentFunction(Disjunction);
+    if (!argFnType)
       return false;
 
     auto currentScore = getCurrentScore();
@@ -76,6 +76,7 @@ ExpressionTimer::~ExpressionTimer() {
 ConstraintSystem::ConstraintSystem(DeclContext *dc,
                                    ConstraintSystemOptions options)
   : Context(dc->getASTContext()), DC(dc), Options(options),
+    AllocatorGuard(dc->getASTContext()), Allocator(AllocatorGuard.Allocator),
     Arena(dc->getASTContext(), Allocator),
     CG(*new ConstraintGraph(*this))
 {
@@ -92,6 +93,11 @@ ConstraintSystem::ConstraintSystem(DeclContext *dc,
 
 ConstraintSystem::~ConstraintSystem() {
   delete &CG;
+
+  // The allocator is handed back to the ASTContext's reuse pool by
+  // AllocatorGuard's destructor, which runs only after the Arena member is
+  // torn down: the arena's teardown destroys conformances allocated from
+  // these slabs, so they must stay alive until then.
 }
 
 void ConstraintSystem::incrementScopeCounter() {
@@ -893,6 +899,20 @@ Optional<Type> ConstraintSystem::isSetType(Type type) {
   return None;
 }
 
+ProtocolConformanceRef
+ConstraintSystem::lookupConformance(Type type, ProtocolDecl *protocol) {
+  auto cacheKey = std::make_pair(type.getPointer(), protocol);
+
+  auto cachedConformance = Conformances.find(cacheKey);
+  if (cachedConformance != Conformances.end())
+    return cachedConformance->second;
+
+  auto conformance =
+      DC->getParentModule()->lookupConformance(type, protocol);
+  Conformances.insert({cacheKey, conformance});
+  return conformance;
+}
+
 Type ConstraintSystem::getFixedTypeRecursive(Type type,
                                              TypeMatchOptions &flags,
                                              bool wantRValue) const {
@@ -26,6 +26,7 @@
 #include "swift/AST/ParameterList.h"
 #include "swift/AST/PropertyWrappers.h"
 #include "swift/AST/ProtocolConformance.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/AST/SubstitutionMap.h"
 #include "swift/AST/TypeCheckRequests.h"
 #include "swift/Parse/Confusables.h"
@@ -429,6 +430,36 @@ Expr *TypeChecker::resolveDeclRefExpr(UnresolvedDeclRefExpr *UDRE,
 
   auto &Context = DC->getASTContext();
 
+  // Operators can only be declared at module or type scope, so the
+  // result of resolving one doesn't depend on where in the file it is
+  // used — only on the innermost type context, which can contribute
+  // member operators. Files full of arithmetic resolve the same handful
+  // of operator names thousands of times; serve repeats from a cache on
+  // the source file.
+  auto operatorLookupCacheKey =
+      [&]() -> Optional<SourceFile::OperatorLookupKey> {
+    if (!Name.isOperator() || Loc.isInvalid())
+      return None;
+
+    const DeclContext *innermostType = DC->getInnermostTypeContext();
+    return SourceFile::OperatorLookupKey(
+        {Name.getBaseIdentifier(), innermostType},
+        static_cast<unsigned>(UDRE->getRefKind()));
+  }();
+
+  SourceFile *operatorCacheFile =
+      operatorLookupCacheKey ? DC->getParentSourceFile() : nullptr;
+  if (operatorCacheFile) {
+    auto cached =
+        operatorCacheFile->PreCheckedOperatorLookups.find(*operatorLookupCacheKey);
+    if (cached != operatorCacheFile->PreCheckedOperatorLookups.end()) {
+      SmallVector<ValueDecl *, 4> cachedValues(cached->second.begin(),
+                                               cached->second.end());
+      return buildRefExpr(cachedValues, DC, UDRE->getNameLoc(),
+                          UDRE->isImplicit(), UDRE->getFunctionRefKind());
+    }
+  }
+
   // First, look for a local binding in scope.
   if (Loc.isValid() && !Name.isOperator()) {
     SmallVector<ValueDecl *, 2> localDecls;
@@ -670,6 +701,13 @@ Expr *TypeChecker::resolveDeclRefExpr(UnresolvedDeclRefExpr *UDRE,
       });
     }
 
+    // Remember the (sorted) candidate set for this operator so later uses
+    // in the file skip the lookup entirely.
+    if (operatorCacheFile) {
+      operatorCacheFile->PreCheckedOperatorLookups[*operatorLookupCacheKey] =
+          std::vector<ValueDecl *>(ResultValues.begin(), ResultValues.end());
+    }
+
     return buildRefExpr(ResultValues, DC, UDRE->getNameLoc(),
                         UDRE->isImplicit(), UDRE->getFunctionRefKind());
   }
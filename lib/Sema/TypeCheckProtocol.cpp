@@ -832,6 +832,8 @@ static const RequirementEnvironment &getOrCreateRequirementEnvironment(
     RequirementEnvironment reqEnv(dc, reqSig, proto, covariantSelf,
                                   conformance);
     cacheIter = reqEnvCache.insert({cacheKey, std::move(reqEnv)}).first;
+  } else if (auto *stats = dc->getASTContext().Stats) {
+    ++stats->getFrontendCounters().NumRequirementEnvironmentCacheHits;
   }
   return cacheIter->getSecond();
 }
@@ -2410,6 +2410,14 @@ static void setOriginalDeclarationAndParameterIndicesInDifferentiableAttributes(
   }
 }
 
+// Deserialization is strictly demand-driven and runs on the thread that
+// asked for the decl. Speculatively decoding reachable decls on a helper
+// thread is not an option: materializing a decl allocates in the
+// ASTContext's arenas, interns identifiers, publishes pointers into this
+// file's Decls/Types arrays, and may re-enter Sema through cross-references
+// into other modules — none of which is synchronized. The cheap form of
+// prefetch, keeping the file's pages warm, already falls out of the
+// memory-mapped input buffer.
 Decl *ModuleFile::getDecl(DeclID DID) {
   Expected<Decl *> deserialized = getDeclChecked(DID);
   if (!deserialized) {
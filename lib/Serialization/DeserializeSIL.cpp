@@ -448,6 +448,15 @@ SILGlobalVariable *SILDeserializer::getGlobalForReference(StringRef name) {
 /// SILFunction can either be an empty declaration or null. If it is an empty
 /// declaration, we fill in the contents. If the input SILFunction is
 /// null, we create a SILFunction.
+///
+/// This never scans the SIL block: the module's index maps each function ID
+/// to the bit offset of its SIL_FUNCTION record (the Funcs cache, populated
+/// from SIL_FUNC_OFFSETS) and the name-keyed on-disk hash table resolves
+/// lookups to IDs, so the cursor jumps straight to the record. With
+/// \p declarationOnly set, only the record's header is decoded and the body
+/// stays on disk until the SIL linker asks for a definition — referencing a
+/// serialized function from another module does not by itself pull in its
+/// blocks.
 SILFunction *SILDeserializer::readSILFunction(DeclID FID,
                                               SILFunction *existingFn,
                                               StringRef name,
@@ -99,6 +99,7 @@ ModuleFile::ModuleFile(std::shared_ptr<const ModuleFileSharedCore> core)
   SILIndexCursor = core->SILIndexCursor;
   DeclMemberTablesCursor = core->DeclMemberTablesCursor;
 
+  Dependencies.reserve(core->Dependencies.size());
   for (const auto &coreDep : core->Dependencies) {
     Dependencies.emplace_back(coreDep);
   }
@@ -688,11 +689,18 @@ ModuleFile::loadNamedMembers(const IterableDeclContext *IDC, DeclBaseName N,
   assert(Core->DeclMemberNames);
 
   TinyPtrVector<ValueDecl *> results;
-  auto i = Core->DeclMemberNames->find(N);
-  if (i == Core->DeclMemberNames->end())
+  auto cached = DeclMemberNamesCache.find(N);
+  if (cached == DeclMemberNamesCache.end()) {
+    auto i = Core->DeclMemberNames->find(N);
+    if (i == Core->DeclMemberNames->end())
+      cached = DeclMemberNamesCache.insert({N, None}).first;
+    else
+      cached = DeclMemberNamesCache.insert({N, BitOffset(*i)}).first;
+  }
+  if (!cached->second)
     return results;
 
-  BitOffset subTableOffset = *i;
+  BitOffset subTableOffset = *cached->second;
   std::unique_ptr<SerializedDeclMembersTable> &subTable =
     DeclMembersTables[subTableOffset];
   if (!subTable) {
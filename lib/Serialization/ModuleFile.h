@@ -281,6 +281,14 @@ private:
   llvm::DenseMap<uint32_t,
            std::unique_ptr<SerializedDeclMembersTable>> DeclMembersTables;
 
+  /// Memoized probes of the on-disk DeclMemberNames hash table, including
+  /// misses (\c None). Named lazy member loading probes the same per-name
+  /// entry once for a nominal and once for each of its deserialized
+  /// extensions, so cache the resulting bit offset rather than re-hashing
+  /// the name against the mmapped table every time.
+  llvm::DenseMap<DeclBaseName, Optional<serialization::BitOffset>>
+      DeclMemberNamesCache;
+
   llvm::DenseMap<const ValueDecl *, Identifier> PrivateDiscriminatorsByValue;
   llvm::DenseMap<const ValueDecl *, StringRef> FilenamesForPrivateValues;
 
@@ -894,6 +894,14 @@ getActualImportControl(unsigned rawValue) {
   }
 }
 
+// Note on cost: only the signature, control block, and table headers are
+// decoded here. The comment payloads themselves sit behind USR-keyed
+// on-disk hash tables that read straight out of the (memory-mapped) buffer,
+// so a compilation that never asks for a doc string pays for one file open
+// and a couple of page touches, not for the documentation bytes. The
+// validation cannot be deferred to first query: this object is immutable
+// and shared across ASTContexts, and lazily initializing it under
+// concurrent readers would require locking on every lookup.
 bool ModuleFileSharedCore::readModuleDocIfPresent() {
   if (!this->ModuleDocInputBuffer)
     return true;
@@ -1039,6 +1047,9 @@ bool ModuleFileSharedCore::readDeclLocsBlock(llvm::BitstreamCursor &cursor) {
   return false;
 }
 
+// The same laziness note as on readModuleDocIfPresent applies: location
+// data stays behind USR-keyed on-disk tables until queried, and builds that
+// want to avoid even the file open can pass -ignore-module-source-info.
 bool ModuleFileSharedCore::readModuleSourceInfoIfPresent() {
   if (!this->ModuleSourceInfoInputBuffer)
     return true;
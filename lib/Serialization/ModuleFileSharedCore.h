@@ -35,6 +35,18 @@ namespace swift {
 ///   * a `ModuleFile` should access its assigned `ModuleFileSharedCore` as
 ///   immutable and thread-safe
 ///   * `ModuleFileSharedCore` should be Independent of an `ASTContext` object.
+///
+/// Loading a module is designed to touch as little of the (typically
+/// memory-mapped) file as possible. Lookup tables are
+/// llvm::OnDiskIterableChainedHashTables that read directly out of the
+/// buffer, identifiers stay as a StringRef into the IdentifierData blob
+/// until requested, and decls, types, and conformances are only decoded
+/// when a `ModuleFile` first resolves their ID — the per-ID state starts
+/// as a bit offset into the buffer and is overwritten with the
+/// materialized object's pointer. The offset arrays themselves are the
+/// one piece decoded eagerly: bitstream records are VBR-compressed, so
+/// they cannot be used in place, and each `ModuleFile` additionally needs
+/// its own mutable copy to do the offset-to-pointer replacement.
 class ModuleFileSharedCore {
   friend class ModuleFile;
   using DeclID = serialization::DeclID;
@@ -4695,6 +4695,13 @@ bool Serializer::writeASTBlockEntitiesIfNeeded(
   return true;
 }
 
+// Note that decl and type records are not relocatable between emissions:
+// every DeclID, TypeID, and IdentifierID embedded in a record is assigned
+// by the order in which this worklist happens to discover entities, and
+// record boundaries are bit- rather than byte-aligned. Changing one decl
+// therefore reflows the IDs and offsets of everything serialized after it,
+// which is why an incremental emitter cannot splice unchanged records out
+// of the previous swiftmodule even when their fingerprints match.
 void Serializer::writeAllDeclsAndTypes() {
   BCBlockRAII restoreBlock(Out, DECLS_AND_TYPES_BLOCK_ID, 8);
   using namespace decls_block;
@@ -5528,6 +5535,13 @@ void Serializer::writeToStream(
   // FIXME: This is only really needed for debugging. We don't actually use it.
   S.writeBlockInfoBlock();
 
+  // The blocks below are written serially through a single BitstreamWriter,
+  // and that is load-bearing: the decl/type block is a worklist that assigns
+  // IDs on demand as records reference each other (including from SIL into
+  // the AST), the index block records absolute bit offsets of everything
+  // written before it, and abbreviation IDs are scoped to the writer.
+  // Serializing blocks into separate buffers and splicing them would
+  // invalidate every recorded offset and cross-block ID.
   {
     BCBlockRAII moduleBlock(S.Out, MODULE_BLOCK_ID, 2);
     S.writeHeader(options);
@@ -63,6 +63,15 @@ int serializeSymbolGraph(SymbolGraph &SG,
 // MARK: - Main Entry Point
 
 /// Emit a symbol graph JSON file for a `ModuleDecl`.
+///
+/// Both phases here stay on one thread by necessity. The walk pulls decl
+/// members, USRs, and availability through the request evaluator, which
+/// mutates the shared ASTContext; and serialization is not a pure dump
+/// either, since printing declaration fragments and type names triggers
+/// the same lazy state. The unit of parallelism is the module: each
+/// swift-symbolgraph-extract invocation owns its process and context, so
+/// a many-module documentation pipeline scales by running extractions
+/// concurrently, not by threading inside one of them.
 int
 symbolgraphgen::emitSymbolGraphForModule(ModuleDecl *M,
                                          const SymbolGraphOptions &Options) {
@@ -34,6 +34,7 @@ SyntaxTreeCreator::SyntaxTreeCreator(SourceManager &SM, unsigned bufferID,
     : SM(SM), BufferID(bufferID), Arena(std::move(arena)),
       SyntaxCache(syntaxCache) {
   StringRef BufferContent = SM.getEntireTextForBuffer(BufferID);
+  SourceBufferStart = BufferContent.data();
   const char *Data = BufferContent.data();
   Arena->copyStringToArenaIfNecessary(Data, BufferContent.size());
   ArenaSourceBuffer = StringRef(Data, BufferContent.size());
@@ -114,8 +115,10 @@ OpaqueSyntaxNode SyntaxTreeCreator::recordToken(tok tokenKind,
                                                 CharSourceRange range) {
   unsigned tokLength =
       range.getByteLength() - leadingTrivia.size() - trailingTrivia.size();
-  auto leadingTriviaStartOffset =
-      SM.getLocOffsetInBuffer(range.getStart(), BufferID);
+  assert(range.getStart().isValid());
+  size_t leadingTriviaStartOffset =
+      (const char *)range.getStart().getOpaquePointerValue() -
+      SourceBufferStart;
   auto tokStartOffset = leadingTriviaStartOffset + leadingTrivia.size();
   auto trailingTriviaStartOffset = tokStartOffset + tokLength;
 
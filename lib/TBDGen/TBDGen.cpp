@@ -1275,6 +1275,16 @@ static bool isApplicationExtensionSafe(const LangOptions &LangOpts) {
          llvm::sys::Process::GetEnv("LD_APPLICATION_EXTENSION_SAFE");
 }
 
+// The symbol enumeration below always walks the whole descriptor (a file
+// or the full module); there is no fragment cache keyed by per-file
+// fingerprints. A symbol's presence and linkage are not file-local facts:
+// linear-order fallbacks, @main entry points, conformance and dispatch
+// thunk visibility all depend on module-wide state, and a source
+// fingerprint does not capture changes in the deployment target, TBD
+// options, or imported availability that move symbols between files'
+// contributions. What bounds the cost instead is that this is a request —
+// within a frontend invocation the result is evaluator-cached, so
+// emit-tbd, symbol-source lookup, and InstallAPI all share one walk.
 TBDFile GenerateTBDRequest::evaluate(Evaluator &evaluator,
                                      TBDGenDescriptor desc) const {
   auto *M = desc.getParentModule();
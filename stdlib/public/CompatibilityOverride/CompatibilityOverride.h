@@ -116,6 +116,15 @@ namespace swift {
 /// OVERRIDE macro from CompatibilityOverride.def to this macro, then includes
 /// the file to generate the override points. The original implementation of the
 /// functionality must be available as swift_funcNameHereImpl.
+///
+/// Steady-state cost: after the first call, the swift_once fast path is a
+/// single load-and-compare and the Override test is a well-predicted
+/// not-taken branch. Patching this away — e.g. dispatching every call
+/// through a function-pointer table rewritten once "no overrides" is known —
+/// would replace those two predictable branches with an indirect call
+/// through writable memory, which is no faster and hands out a mutable,
+/// unsigned function pointer on arm64e. The entry points themselves are
+/// exported ABI symbols, so rewriting their code is not an option either.
 #define COMPATIBILITY_OVERRIDE(name, ret, attrs, ccAttrs, namespace,           \
                                typedArgs, namedArgs)                           \
   attrs ccAttrs ret namespace swift_##name COMPATIBILITY_PAREN(typedArgs) {    \
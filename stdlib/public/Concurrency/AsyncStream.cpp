@@ -12,6 +12,22 @@
 
 #include "swift/Runtime/Mutex.h"
 
+// These shims exist because the stream state machine is implemented in
+// AsyncStreamBuffer.swift, which cannot name the platform mutex directly.
+//
+// The mutex is load-bearing in ways a lock-free MPSC ring would not cover:
+// the critical section in yield/next is not a queue push or pop but the
+// whole buffering-policy state machine — enforcing the buffer limit,
+// dropping from the *head* for .bufferingNewest (a producer-side dequeue,
+// which breaks the single-consumer assumption), handing the pending
+// continuation off exactly once, and running termination handlers against
+// a consistent view. Elements are also arbitrary ARC-managed values whose
+// ownership transfer has to happen under the same synchronization as the
+// state transition. On every supported platform the uncontended
+// MutexPlatformHelper path is a single atomic; producers that measure
+// this lock as a ceiling are contending on the semantic serialization of
+// yields, which any correct implementation of these policies must retain.
+
 namespace swift {
 // return the size in words for the given mutex primitive
 extern "C"
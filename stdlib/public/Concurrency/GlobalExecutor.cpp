@@ -85,6 +85,26 @@ void (*swift::swift_task_enqueueMainExecutor_hook)(
 #include <chrono>
 #include <thread>
 
+// The cooperative global executor below is not a scaled-down thread pool:
+// it is the single-threaded fallback for runtimes without any threading
+// support (and for -enable-experimental-single-threaded-runtime builds),
+// which is why its queues are bare linked lists with no locking at all.
+// Multi-threaded targets run the global executor on Dispatch's pool, so
+// making *this* path per-core work-stealing would give it threads the
+// configuration promises not to create. A process that outscales the
+// platform pool should install its own scheduler through the
+// swift_task_enqueueGlobal_hook family above — the hooks receive every
+// job before the default path and exist precisely so a work-stealing
+// executor can be swapped in without modifying the runtime.
+//
+// The same applies to thread placement policy (pool width, NUMA node
+// binding, per-node run queues): on the default path those are decisions
+// Dispatch makes for the whole process, and this runtime neither creates
+// the threads nor has a portable topology API to pin them with. A process
+// that needs node-local scheduling should install a hook-based executor
+// that owns its threads outright and can bind them however the deployment
+// requires; the runtime will faithfully hand it every global enqueue.
+
 static Job *JobQueue = nullptr;
 
 class DelayedJob {
@@ -471,6 +471,18 @@ static void swift_taskGroup_initializeImpl(TaskGroup *group, const Metadata *T)
 
 // =============================================================================
 // ==== add / attachChild ------------------------------------------------------
+
+// Children are created and attached one at a time, each with its own malloc'd
+// task allocation (see swift_task_create_common). Block-allocating a fan-out
+// of homogeneous children does not work here: group children complete and are
+// deallocated out of order on arbitrary threads, so they cannot share the
+// LIFO task allocator the way async-let children share their parent's, and a
+// per-group slab could not retire until its last occupant finished. Batching
+// the enqueues is likewise off the table at this layer — each child's closure
+// context is materialized by compiler-emitted code between spawn calls, so a
+// take-N entry point would require new ABI on both sides. Amortizing
+// scheduling overhead for many small children belongs in the executor (or a
+// swift_task_enqueueGlobal hook), not in the group.
 SWIFT_CC(swift)
 static void swift_taskGroup_attachChildImpl(TaskGroup *group,
                                             AsyncTask *child) {
@@ -198,10 +198,13 @@ TypeRefBuilder::getFieldTypeInfo(const TypeRef *TR) {
   if (Found != FieldTypeInfoCache.end())
     return Found->second;
 
-  // On failure, fill out the cache with everything we know about.
-  std::vector<std::pair<std::string, const TypeRef *>> Fields;
-  for (auto &Info : ReflectionInfos) {
-    for (auto FD : Info.Field) {
+  // On failure, fill out the cache with everything we know about. Only scan
+  // reflection infos that arrived since the last scan, so that repeated
+  // lookups of types with no field descriptor (common when walking a heap
+  // full of foreign objects) don't re-normalize every descriptor each time.
+  for (size_t i = FieldTypeInfoCacheScannedInfos, e = ReflectionInfos.size();
+       i != e; ++i) {
+    for (auto FD : ReflectionInfos[i].Field) {
       if (!FD->hasMangledTypeName())
         continue;
       auto CandidateMangledName = readTypeRef(FD, FD->MangledTypeName);
@@ -209,6 +212,7 @@ TypeRefBuilder::getFieldTypeInfo(const TypeRef *TR) {
         FieldTypeInfoCache[*NormalizedName] = FD;
     }
   }
+  FieldTypeInfoCacheScannedInfos = ReflectionInfos.size();
 
   // We've filled the cache with everything we know about now. Try the cache again.
   Found = FieldTypeInfoCache.find(MangledName);
@@ -65,12 +65,24 @@ typedef InlineRefCountsPlaceholder InlineRefCounts;
   * strong RC or unowned RC overflows (inline RCs will be small on 32-bit)
   * associated object storage is needed on an object
   * etc
-  Gaining a side table entry is a one-way operation; an object with a side 
+  Gaining a side table entry is a one-way operation; an object with a side
   table entry never loses it. This prevents some thread races.
 
   Strong and unowned variables point at the object.
   Weak variables point at the object's side table.
 
+  A note on biased (owner-thread) refcounting: schemes that keep a
+  non-atomic count for the allocating thread and revoke the bias on first
+  cross-thread access do not fit this layout. The inline bits are fully
+  allocated (strong extra-count, unowned count, flags), so there is no room
+  for an owner thread ID, and spilling it to a side table on allocation
+  would cost more than the atomics it saves. The refcount word is also ABI:
+  it is read directly by the Objective-C runtime bridge, debuggers, and
+  leaks tooling, which all assume the current bit assignments. The
+  supported ways to shed retain/release traffic are the compiler's ARC
+  optimizer (removes paired operations outright), isUniquelyReferenced
+  fast paths, and immortal objects, which skip the RMW entirely.
+
 
   Storage layout:
 
@@ -20,6 +20,18 @@
 // arrayAssignWithTake(T *dest, T *src, size_t count, M* self)
 // arrayDestroy(T *dst, size_t count, M* self)
 //
+// These are generic element-buffer copy/destroy helpers only; no ObjC
+// bridging verification happens here. When an NSArray is bridged to a
+// native Array, element type checks are performed lazily by the core
+// library (_ArrayBuffer's deferred element type checking) on first access
+// to each element, precisely so that bridging a multi-thousand-element
+// array stays O(1) at the bridge point. An eager batched verify-and-copy
+// pass would touch every element's isa up front, turning that O(1) bridge
+// into the O(n) scan the lazy scheme exists to avoid — a net loss for the
+// common case where only part of the array is ever read. Runs of verified
+// elements already memcpy through the POD path below when the element
+// type permits it.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/Runtime/Config.h"
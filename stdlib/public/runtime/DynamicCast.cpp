@@ -1926,6 +1926,18 @@ tryCastToExistentialMetatype(
 // Based on the destination type alone, select a targeted casting function.
 // This design avoids some redundant inspection of the destination type
 // data, for example, when we unwrap source boxes.
+//
+// Note that this dispatch — a switch on the destination kind plus a few
+// descriptor compares — is the only per-call work that depends purely on
+// the metadata pair, so a (source type, destination type) result cache
+// could memoize nothing more than this switch. Everything else a cast does
+// is value-dependent: a class downcast consults the stored object's
+// dynamic type, an optional unwrap depends on whether the value is nil,
+// and existential/AnyHashable/SwiftValue/NSError sources are unwrapped by
+// content. The one expensive metadata-pair-only subproblem, protocol
+// conformance checking, is already memoized process-wide by
+// swift_conformsToProtocol's conformance cache, so repeated casts between
+// the same pairs hit that cache and re-run only the cheap dispatch here.
 static tryCastFunctionType *selectCasterForDest(const Metadata *destType) {
   auto destKind = destType->getKind();
   switch (destKind) {
@@ -222,6 +222,18 @@ struct MultiPayloadLayout {
 };
 } // end anonymous namespace
 
+// Deriving the layout on each call is deliberate. Everything these tag
+// witnesses need — total size, payload size, extra inhabitant count — is
+// already memoized as plain fields of the published value witness table
+// and enum metadata, so "recomputation" is two loads and a subtraction
+// from cache-hot metadata. There is nowhere better to put precomputed
+// shift/mask constants: the value witness table layout is ABI and has no
+// private data area to grow into, and a per-type side table would cost a
+// lookup where the current code costs arithmetic. Instantiation-time
+// specialization already happens at the level that pays:
+// installCommonValueWitnesses swaps in size-class-specialized copy/destroy
+// witnesses, and swift_initEnumMetadataMultiPayload installs these
+// functions only for enums whose layout genuinely needs dynamic handling.
 static MultiPayloadLayout getMultiPayloadLayout(const EnumMetadata *enumType) {
   size_t payloadSize = enumType->getPayloadSize();
   size_t totalSize = enumType->getValueWitnesses()->size;
@@ -64,6 +64,15 @@ static const FullMetadata<HeapMetadata> ErrorMetadata{
   HeapMetadata(MetadataKind::ErrorObject),
 };
 
+// Error boxes are deliberately plain refcounted heap objects with no
+// recycling pool in front of swift_allocObject. The hot-path free is not
+// swift_deallocError (that only runs when error construction is abandoned)
+// but _destroyErrorObject, which runs on whatever thread drops the last
+// reference — so a per-thread pool would need cross-thread reclamation,
+// i.e. it would reimplement the allocator underneath. Box sizes also track
+// the boxed value's layout rather than a few fixed classes. Throw-heavy
+// workloads that see this allocation in profiles get the intended fix from
+// a caching system allocator, per the policy in runtime/Heap.cpp.
 BoxPair
 swift::swift_allocError(const swift::Metadata *type,
                         const swift::WitnessTable *errorConformance,
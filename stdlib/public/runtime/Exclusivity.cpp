@@ -167,6 +167,18 @@ static_assert(sizeof(Access) <= sizeof(ValueBuffer) &&
               "Access doesn't fit in a value buffer!");
 
 /// A set of accesses that we're tracking.  Just a singly-linked list.
+///
+/// The list is intrusive by necessity: each node is a compiler-allocated
+/// scratch buffer in the accessing frame (see the table above), which the
+/// runtime does not own and cannot relocate, so a compact inline array of
+/// records is off the table — the best an auxiliary array could hold is
+/// pointers to the same scattered stack slots, which buys no locality and
+/// complicates remove(), whose argument is the raw record address and whose
+/// removals are not LIFO (unpaired accesses end in any order). The walk
+/// length equals the number of accesses concurrently live on this thread,
+/// which is the nesting depth of inout/mutating operations — almost always
+/// zero to two — so traversal cost here is dominated by reaching the TLS
+/// context, not by the list itself.
 class AccessSet {
   Access *Head = nullptr;
 public:
@@ -68,6 +68,19 @@ static inline malloc_zone_t *DEFAULT_ZONE() {
 }
 #endif
 
+// swift_slowAlloc is deliberately a thin shim over the system allocator
+// rather than a caching layer of its own. A thread-local magazine for the
+// small size classes would have to handle cross-thread frees (Swift objects
+// routinely deallocate on a different thread than they were allocated on),
+// at which point it is a full allocator shadowing the one underneath — and
+// it would hide Swift heap traffic from every tool that understands malloc:
+// leak detectors, malloc stack logging, the sanitizers, and heap profilers.
+// Processes that lose CPU to glibc arena locking get exactly the requested
+// behavior by interposing a caching allocator (jemalloc, tcmalloc) for the
+// whole process, which also covers the C/C++ allocations these workloads
+// mix in; the runtime stays agnostic by funneling everything through the
+// plain malloc entry points below.
+//
 // When alignMask == ~(size_t(0)), allocation uses the "default"
 // _swift_MinAllocationAlignment. This is different than calling swift_slowAlloc
 // with `alignMask == _swift_MinAllocationAlignment - 1` because it forces
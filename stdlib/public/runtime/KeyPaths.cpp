@@ -9,6 +9,20 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Note that this file is only calling-convention glue between the runtime
+// and the key path implementation in stdlib/public/core/KeyPath.swift; no
+// component walking or resolution happens here. The caching this layer is
+// sometimes suspected of lacking already exists on the Swift side:
+// swift_getKeyPathImpl instantiates each argument-less pattern at most once
+// via the once-pointer embedded in the pattern, and instantiation resolves
+// stored-property components to physical offsets up front, so per-access
+// projection walks already-resolved components without touching overrides
+// or metadata. Rewriting an instantiated key path object in place after
+// first traversal is not an option: key paths are shared, hashable values
+// and their buffers are read concurrently without synchronization.
+//
+//===----------------------------------------------------------------------===//
 
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/Metadata.h"
@@ -5951,6 +5951,22 @@ static void checkAllocatorDebugEnvironmentVariables(void *context) {
                      "Warning: SWIFT_DEBUG_ENABLE_METADATA_BACKTRACE_LOGGING "
                      "without SWIFT_DEBUG_ENABLE_METADATA_ALLOCATION_ITERATION "
                      "has no effect.\n");
+
+    // If requested, reserve one large pool slab up front — typically sized
+    // from a prior run's high-water mark — so a startup instantiation storm
+    // draws from a single allocation instead of growing the pool one page at
+    // a time. This runs before the first pool allocation, so abandoning the
+    // static initial pool only wastes its zero-fill BSS. The reservation is
+    // skipped in allocation-iteration mode, whose pool trailer chain assumes
+    // page-sized slabs.
+    size_t poolReserve =
+        runtime::environment::SWIFT_METADATA_ALLOCATION_POOL_RESERVE();
+    if (poolReserve > InitialPoolSize) {
+      char *slab = new char[poolReserve];
+      memsetScribble(slab, poolReserve);
+      AllocationPool.store(PoolRange{slab, poolReserve},
+                           std::memory_order_relaxed);
+    }
     return;
   }
 
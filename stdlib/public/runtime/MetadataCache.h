@@ -106,6 +106,20 @@ struct ConcurrencyControl {
   ConcurrencyControl() = default;
 };
 
+/// Storage for a LockingConcurrentMap.
+///
+/// Note that generic metadata caches are already sharded at the natural
+/// granularity: each generic type descriptor embeds its own instance of
+/// this storage in its instantiation cache, so two distinct generic types
+/// never contend with each other. Within one cache, lookups go through
+/// ConcurrentReadableHashMap, whose readers never block on the writer
+/// lock; the only cross-core write a hit performs is the snapshot
+/// reader-count bump. The lock below serializes only inserts and the
+/// wait-queue handoff for in-flight instantiations of the *same* type,
+/// which is inherent to the one-exclusive-initializer protocol. Per-CPU
+/// shards or hazard-pointer reclamation would have to fit in the
+/// descriptor's PrivateData (see below) and would only split traffic that
+/// is already per-type.
 template <class EntryType, uint16_t Tag>
 class LockingConcurrentMapStorage {
   // This class must fit within
@@ -213,19 +213,45 @@ namespace {
   private:
     const char *Name;
     size_t NameLength;
-    const ContextDescriptor *Description;
+
+    /// The descriptor the name resolved to, or null for a cached negative
+    /// result. Atomic because a negative entry may be upgraded in place
+    /// (under the map's writer lock) while readers examine it.
+    std::atomic<const ContextDescriptor *> Description;
+
+    /// For negative entries, the number of registered type metadata
+    /// sections at the time the failed scan began. A negative result is
+    /// only authoritative while no new images have been registered since.
+    std::atomic<size_t> NegativeGeneration;
 
   public:
     NominalTypeDescriptorCacheEntry(const llvm::StringRef name,
-                                    const ContextDescriptor *description)
-        : Description(description) {
+                                    const ContextDescriptor *description,
+                                    size_t negativeGeneration)
+        : Description(description), NegativeGeneration(negativeGeneration) {
       char *nameCopy = reinterpret_cast<char *>(malloc(name.size()));
       memcpy(nameCopy, name.data(), name.size());
       Name = nameCopy;
       NameLength = name.size();
     }
 
-    const ContextDescriptor *getDescription() const { return Description; }
+    const ContextDescriptor *getDescription() const {
+      return Description.load(std::memory_order_acquire);
+    }
+
+    size_t getNegativeGeneration() const {
+      return NegativeGeneration.load(std::memory_order_relaxed);
+    }
+
+    /// Record the result of a re-scan of a stale negative entry.
+    void updateResult(const ContextDescriptor *description,
+                      size_t negativeGeneration) {
+      if (description)
+        Description.store(description, std::memory_order_release);
+      else
+        NegativeGeneration.store(negativeGeneration,
+                                 std::memory_order_relaxed);
+    }
 
     bool matchesKey(llvm::StringRef aName) {
       return aName == llvm::StringRef{Name, NameLength};
@@ -728,30 +754,43 @@ _findContextDescriptor(Demangle::NodePointer node,
     Demangle::mangleNode(node, ExpandResolvedSymbolicReferences(Dem), Dem);
 
   // Look for an existing entry.
-  // Find the bucket for the metadata entry.
+  // Find the bucket for the metadata entry. Negative entries are
+  // authoritative only while no new type metadata sections have been
+  // registered since the failed scan that produced them.
   {
     auto snapshot = T.NominalCache.snapshot();
-    if (auto Value = snapshot.find(mangledName))
-      return Value->getDescription();
+    if (auto Value = snapshot.find(mangledName)) {
+      if (auto description = Value->getDescription())
+        return description;
+      if (Value->getNegativeGeneration() == T.SectionsToScan.snapshot().count())
+        return nullptr;
+    }
   }
 
-  // Check type metadata records		   
+  // Take the section count before scanning so that a negative result is
+  // tagged conservatively: sections registered while we scan will make it
+  // stale and force a re-scan on the next query.
+  size_t negativeGeneration = T.SectionsToScan.snapshot().count();
+
+  // Check type metadata records
   // Scan any newly loaded images for context descriptors, then try the context
   foundContext = _searchTypeMetadataRecords(T, node);
-  
-  // Check protocol conformances table. Note that this has no support for		
+
+  // Check protocol conformances table. Note that this has no support for
   // resolving generic types yet.
   if (!foundContext)
     foundContext = _searchConformancesByMangledTypeName(node);
-  
-  if (foundContext)
-    T.NominalCache.getOrInsert(mangledName, [&](NominalTypeDescriptorCacheEntry
-                                                    *entry,
-                                                bool created) {
-      if (created)
-        new (entry) NominalTypeDescriptorCacheEntry{mangledName, foundContext};
-      return true;
-    });
+
+  T.NominalCache.getOrInsert(mangledName, [&](NominalTypeDescriptorCacheEntry
+                                                  *entry,
+                                              bool created) {
+    if (created)
+      new (entry) NominalTypeDescriptorCacheEntry{mangledName, foundContext,
+                                                  negativeGeneration};
+    else
+      entry->updateResult(foundContext, negativeGeneration);
+    return true;
+  });
 
   return foundContext;
 }
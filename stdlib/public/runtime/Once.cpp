@@ -34,9 +34,33 @@ using namespace swift;
 #include <dispatch/dispatch.h>
 static_assert(std::is_same<swift_once_t, dispatch_once_t>::value,
               "swift_once_t and dispatch_once_t must stay in sync");
+
+#elif defined(__linux__)
+
+// On Linux, swift_once is implemented below with a predicate encoding the
+// compiler knows about: -1 means initialization is complete, so the inline
+// fast path emitted for Builtin.once is a single acquire load-and-compare
+// with no runtime call. See SwiftTargetInfo.OnceDonePredicateValue. Initialization
+// races are rare and short, so all in-flight predicates share one static
+// mutex and condition variable instead of per-predicate waiter state.
+
+#include "swift/Runtime/Mutex.h"
+#include <atomic>
+
+namespace {
+enum : swift_once_t {
+  OnceIncomplete = 0,
+  OnceInProgress = 1,
+  OnceDone = -1
+};
+} // end anonymous namespace
+
+static StaticConditionVariable::StaticMutex OnceMutex;
+static StaticConditionVariable OnceCond;
+
 #else
 
-// On non-Darwin platforms we do not assume any barrier-free inline path
+// On the remaining platforms we do not assume any barrier-free inline path
 // and SwiftTargetInfo.OnceDonePredicateValue is unset in the compiler.
 
 #endif
@@ -59,6 +83,41 @@ void swift::swift_once(swift_once_t *predicate, void (*fn)(void *),
   }
 #elif defined(__APPLE__)
   dispatch_once_f(predicate, context, fn);
+#elif defined(__linux__)
+  auto *pred = reinterpret_cast<std::atomic<swift_once_t> *>(predicate);
+
+  // The compiler normally performs this check inline, but swift_once is
+  // also called directly from within the runtime.
+  if (pred->load(std::memory_order_acquire) == OnceDone)
+    return;
+
+  bool runner = false;
+  OnceMutex.withLockOrWait(OnceCond, [&] {
+    switch (pred->load(std::memory_order_relaxed)) {
+    case OnceIncomplete:
+      pred->store(OnceInProgress, std::memory_order_relaxed);
+      runner = true;
+      return true;
+    case OnceInProgress:
+      // Another thread is running the initializer; wait for it.
+      return false;
+    default:
+      // Initialization completed while we were waiting.
+      return true;
+    }
+  });
+  if (!runner)
+    return;
+
+  fn(context);
+
+  // The release store pairs with the acquire load at the top of this
+  // function and with the atomic acquire load the compiler emits for the
+  // inline Builtin.once check on non-Darwin targets (see GenBuiltin.cpp);
+  // waiters blocked above are ordered by the mutex instead.
+  OnceMutex.withLockThenNotifyAll(OnceCond, [&] {
+    pred->store(OnceDone, std::memory_order_release);
+  });
 #elif defined(__CYGWIN__)
   _swift_once_f(predicate, context, fn);
 #else
@@ -385,6 +385,10 @@ struct ConformanceState {
     scanSectionsBackwards =
         runtime::bincompat::workaroundProtocolConformanceReverseIteration();
 
+    if (auto reserveSize =
+            runtime::environment::SWIFT_CONFORMANCE_CACHE_RESERVE())
+      Cache.reserve(reserveSize);
+
 #if USE_DYLD_SHARED_CACHE_CONFORMANCE_TABLES
     if (__builtin_available(macOS 12.0, iOS 15.0, tvOS 15.0, watchOS 8.0, *)) {
       if (runtime::environment::SWIFT_DEBUG_ENABLE_SHARED_CACHE_PROTOCOL_CONFORMANCES()) {
@@ -865,6 +869,21 @@ swift_conformsToProtocolImpl(const Metadata *const type,
   }
 
   // Scan conformance records.
+  //
+  // This linear walk over every image's conformance section is the slow
+  // path, but it runs at most once per (type, protocol) query: both the
+  // positive and the negative outcome are recorded in the cache above, so a
+  // burst of first-time dynamic casts pays for each distinct query once,
+  // not per cast. A compile-time sorted or hashed per-image index would
+  // need IRGen to emit a new section and the runtime to trust it — a new
+  // piece of ABI that every old image in the process would lack, so the
+  // scan below has to stay as the fallback regardless. Where the platform
+  // does precompute an index — the dyld shared cache conformance tables
+  // consulted earlier in this function — we already use it and skip the
+  // scan entirely. Note also that a per-protocol index could not answer
+  // these queries directly: matching is per conformance descriptor
+  // (superclasses, generic conformances), so candidates must be decoded
+  // and matched against the type either way.
   llvm::SmallDenseMap<const Metadata *, const WitnessTable *> foundWitnesses;
   auto processSection = [&](const ConformanceSection &section) {
     // Eagerly pull records for nondependent witnesses into our cache.
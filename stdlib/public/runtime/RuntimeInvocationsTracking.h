@@ -13,6 +13,18 @@
 // Track invocations of Swift runtime functions. This can be used for
 // performance analysis.
 //
+// This is the runtime's counter surface: global and per-object invocation
+// counts for the entry points listed in RuntimeInvocationsTracking.def,
+// snapshot entry points (_swift_getGlobalRuntimeFunctionCounters and
+// friends), and an update-handler hook for streaming them out of a live
+// process. It is gated on a build-time define rather than an environment
+// variable on purpose: the interesting counters sit in retain/release and
+// allocation, where even a well-predicted is-enabled branch is measurable,
+// so production toolchains compile the tracking out entirely instead of
+// carrying a runtime toggle in the hottest paths. Cycle attribution is
+// intentionally out of scope — counts compose with an external profiler,
+// which can attribute time far better than the runtime can self-report.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_STDLIB_RUNTIME_INVOCATIONS_TRACKING_H
@@ -44,6 +44,19 @@ namespace swift {
 ///
 /// It's possible to place the first slab into pre-allocated memory.
 ///
+/// That first-slab mechanism is also the intended answer to task
+/// setup/teardown cost: the task runtime carves the initial slab out of
+/// the task object's own allocation, so a short-lived task that stays
+/// within it performs no slab malloc or free at all — its allocator
+/// storage lives and dies with the task's single heap allocation. Slabs
+/// beyond the first cannot usefully be pooled per executor thread: tasks
+/// migrate between threads and are destroyed on whichever thread drops
+/// the last reference, so a per-thread free list would need cross-thread
+/// reclamation — a general-purpose allocator, which is the system
+/// malloc's job. Overflowing slabs are also sized to the triggering
+/// request (at least SlabCapacity), so pooled slabs would not reliably
+/// fit the next consumer's needs.
+///
 /// The SlabCapacity specifies the capacity for newly allocated slabs.
 template <size_t SlabCapacity>
 class StackAllocator {
@@ -0,0 +1,22 @@
+// RUN: %empty-directory(%t)
+// RUN: %{python} -c 'print("// padding\n" * 400)' > %t/big.swift
+// RUN: touch %t/small-1.swift %t/small-2.swift %t/small-3.swift
+//
+// RUN: %swiftc_driver -enable-batch-mode -driver-show-job-lifecycle -driver-skip-execution -j 2 %t/small-1.swift %t/big.swift %t/small-2.swift %t/small-3.swift | %FileCheck %s
+//
+// The default partitioning assigns jobs longest-first to the least-loaded
+// batch, predicting each job's cost from its primary file's size. The one
+// big file therefore gets a batch to itself (and is assigned first, even
+// though it is listed second), while the three empty files share the other
+// batch; a count-balanced split would have paired it with a small file.
+//
+// CHECK: Found 4 batchable jobs
+// CHECK: Forming into 2 batches
+// CHECK: Adding {compile: {{big-.*}} <= big.swift} to batch 0
+// CHECK: Adding {compile: {{small-1-.*}} <= small-1.swift} to batch 1
+// CHECK: Adding {compile: {{small-2-.*}} <= small-2.swift} to batch 1
+// CHECK: Adding {compile: {{small-3-.*}} <= small-3.swift} to batch 1
+// CHECK: Forming batch job from 1 constituents
+// CHECK: Forming batch job from 3 constituents
+// CHECK: Adding batch job to task queue: {compile: big{{.*}} <= big.swift}
+// CHECK: Adding batch job to task queue: {compile: small-1{{.*}} small-2{{.*}} small-3{{.*}} <= small-1.swift small-2.swift small-3.swift}
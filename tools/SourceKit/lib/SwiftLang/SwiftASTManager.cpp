@@ -361,6 +361,18 @@ struct SwiftASTManager::Implementation {
   llvm::sys::Mutex CacheMtx;
   std::time_t SessionTimestamp;
 
+  /// All AST builds are serialized through this one queue, so a build
+  /// kicked off for a batch consumer can delay an interactive one behind
+  /// it. The granularity of any scheduling improvement here is the whole
+  /// build: a build cannot be preempted mid-Sema, because the request
+  /// evaluator is in the middle of lazy state that has no unwind or
+  /// resume point and the resulting AST is shared by every queued
+  /// consumer. What can be cancelled is a consumer (see oncePerASTToken
+  /// in enqueueConsumer), and a producer whose consumers have all been
+  /// cancelled simply delivers to nobody. The queue stays serial on
+  /// purpose — concurrent AST builds multiply peak memory by the number
+  /// of in-flight invocations — so priority work would mean reordering
+  /// pending builds at dispatch, not preempting the running one.
   WorkQueue ASTBuildQueue{ WorkQueue::Dequeuing::Serial,
                            "sourcekit.swift.ASTBuilding" };
 
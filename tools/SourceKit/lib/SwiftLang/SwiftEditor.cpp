@@ -776,6 +776,17 @@ void SwiftDocumentSemanticInfo::readSemanticInfo(
   Diags = getSemanticDiagnostics(NewSnapshot, ParserDiags);
 }
 
+/// Serve the last computed semantic tokens against a newer snapshot by
+/// splicing around the edits: tokens past an edit are shifted by its
+/// delta and only tokens overlapping the edited range are dropped. This
+/// is what keeps highlighting responsive while typing — the editor keeps
+/// the stale-but-shifted tokens until the next AST generation lands. The
+/// background recomputation stays whole-file on purpose: an edit can
+/// change the classification of references far outside the edited range
+/// (introducing or shadowing a declaration re-resolves names anywhere in
+/// the file), and nothing maps the parser's reused syntax regions to the
+/// set of affected resolutions, so a dirty-range semantic walk would
+/// serve wrong token kinds for unedited text.
 std::vector<SwiftSemanticToken>
 SwiftDocumentSemanticInfo::takeSemanticTokens(
     ImmutableTextSnapshotRef NewSnapshot) {
@@ -58,7 +58,17 @@ class SynParser {
   swiftparse_node_lookup_t NodeLookup = nullptr;
   swiftparse_diagnostic_handler_t DiagHandler = nullptr;
 
+  /// Backing storage for the deferred nodes created while parsing. Owned by
+  /// the parser object rather than a single parse so that its slabs stay warm
+  /// when the same \c swiftparse_parser_t is used to parse many files; it is
+  /// reset at the start of each parse.
+  llvm::BumpPtrAllocator DeferredNodeAllocator;
+
 public:
+  llvm::BumpPtrAllocator &getDeferredNodeAllocator() {
+    return DeferredNodeAllocator;
+  }
+
   swiftparse_node_handler_t getNodeHandler() const {
     return NodeHandler;
   }
@@ -137,11 +147,12 @@ class CLibParseActions final : public SyntaxParseActions {
   SynParser &SynParse;
   SourceManager &SM;
   unsigned BufferID;
-  llvm::BumpPtrAllocator DeferredNodeAllocator;
+  llvm::BumpPtrAllocator &DeferredNodeAllocator;
 
 public:
   CLibParseActions(SynParser &synParse, SourceManager &sm, unsigned bufID)
-  : SynParse(synParse), SM(sm), BufferID(bufID) {}
+      : SynParse(synParse), SM(sm), BufferID(bufID),
+        DeferredNodeAllocator(synParse.getDeferredNodeAllocator()) {}
 
 private:
   swiftparse_node_handler_t getNodeHandler() const {
@@ -478,6 +489,10 @@ struct SynParserDiagConsumer: public DiagnosticConsumer {
 };
 
 swiftparse_client_node_t SynParser::parse(const char *source, size_t len) {
+  // Deferred nodes never outlive the parse they were created in; reclaim
+  // their memory but hang on to the allocated slabs for the next file.
+  DeferredNodeAllocator.Reset();
+
   SourceManager SM;
   unsigned bufID = SM.addNewSourceBuffer(llvm::MemoryBuffer::getMemBuffer(
       StringRef(source, len), "syntax_parse_source"));
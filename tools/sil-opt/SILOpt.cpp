@@ -230,6 +230,12 @@ static llvm::cl::opt<bool>
 EmitVerboseSIL("emit-verbose-sil",
                llvm::cl::desc("Emit locations during sil emission."));
 
+// SIB is the binary round-trip format for SIL tooling: a .sib emitted here
+// (or by sil-func-extractor) is read back through the module deserializer,
+// bypassing the textual SIL parser entirely, so repeated round trips are
+// I/O-bound rather than parse-bound. It reuses SerializeSIL/DeserializeSIL
+// wholesale; a second, AST-free binary container would duplicate that code
+// without being loadable, since SIL bodies reference AST types and decls.
 static llvm::cl::opt<bool>
 EmitSIB("emit-sib", llvm::cl::desc("Emit serialized AST + SIL file(s)"));
 
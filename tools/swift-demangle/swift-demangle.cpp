@@ -31,6 +31,8 @@
 #endif
 
 #include <iostream>
+#include <thread>
+#include <vector>
 
 using namespace swift::Demangle;
 
@@ -98,6 +100,11 @@ static llvm::cl::opt<std::string> HidingModule(
 /// \}
 
 
+static llvm::cl::opt<unsigned>
+NumThreads("j", llvm::cl::init(1), llvm::cl::value_desc("N"),
+           llvm::cl::desc("Demangle standard input on <N> threads, "
+                          "preserving line order"));
+
 static llvm::cl::list<std::string>
 InputNames(llvm::cl::Positional, llvm::cl::desc("[mangled name...]"),
                llvm::cl::ZeroOrMore);
@@ -139,8 +146,8 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
   }
   swift::Demangle::NodePointer pointer = DCtx.demangleSymbolAsNode(name);
   if (ExpandMode || TreeOnly) {
-    llvm::outs() << "Demangling for " << name << '\n';
-    llvm::outs() << getNodeTreeAsString(pointer);
+    os << "Demangling for " << name << '\n';
+    os << getNodeTreeAsString(pointer);
   }
   if (RemangleMode) {
     std::string remangled;
@@ -169,15 +176,15 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
         exit(1);
       }
     }
-    if (hadLeadingUnderscore) llvm::outs() << '_';
-    llvm::outs() << remangled;
+    if (hadLeadingUnderscore) os << '_';
+    os << remangled;
     return;
   } else if (RemangleRtMode) {
     std::string remangled = name.str();
     if (pointer) {
       remangled = swift::Demangle::mangleNodeOld(pointer);
     }
-    llvm::outs() << remangled;
+    os << remangled;
   }
   if (!TreeOnly) {
     if (RemangleNew) {
@@ -186,18 +193,18 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
         exit(1);
       }
       std::string remangled = swift::Demangle::mangleNode(pointer);
-      llvm::outs() << remangled;
+      os << remangled;
       return;
     }
     if (StripSpecialization) {
       stripSpecialization(pointer);
       std::string remangled = swift::Demangle::mangleNode(pointer);
-      llvm::outs() << remangled;
+      os << remangled;
       return;
     }
     std::string string = swift::Demangle::nodeToString(pointer, options);
     if (!CompactMode)
-      llvm::outs() << name << " ---> ";
+      os << name << " ---> ";
 
     if (Classify) {
       std::string Classifications;
@@ -217,30 +224,87 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
         Classifications += 'C';
       }
       if (!Classifications.empty())
-        llvm::outs() << '{' << Classifications << "} ";
+        os << '{' << Classifications << "} ";
     }
-    llvm::outs() << (string.empty() ? name : llvm::StringRef(string));
+    os << (string.empty() ? name : llvm::StringRef(string));
   }
   DCtx.clear();
 }
 
+/// Demangle every symbol-looking substring of one input line to \p os.
+static void demangleLine(llvm::raw_ostream &os, llvm::StringRef inputContents,
+                         llvm::Regex &maybeSymbol,
+                         swift::Demangle::Context &DCtx,
+                         const swift::Demangle::DemangleOptions &options) {
+  llvm::SmallVector<llvm::StringRef, 1> matches;
+  while (maybeSymbol.match(inputContents, &matches)) {
+    os << substrBefore(inputContents, matches.front());
+    demangle(os, matches.front(), DCtx, options);
+    inputContents = substrAfter(inputContents, matches.front());
+  }
+  os << inputContents << '\n';
+}
+
+/// Demangle stdin with \p numWorkers threads, in batches: each worker owns
+/// its own demangler context and renders its lines into per-line string
+/// buffers, which are flushed to stdout in input order after every batch.
+static int
+demangleSTDINParallel(const swift::Demangle::DemangleOptions &options,
+                      unsigned numWorkers) {
+  // Large enough to amortize thread wake-up over a batch, small enough to
+  // bound memory while streaming multi-gigabyte symbol dumps.
+  const size_t linesPerBatch = 16384 * numWorkers;
+
+  std::vector<std::string> lines;
+  std::vector<std::string> results;
+  bool more = true;
+  while (more) {
+    lines.clear();
+    for (std::string mangled; lines.size() < linesPerBatch;) {
+      if (!std::getline(std::cin, mangled)) {
+        more = false;
+        break;
+      }
+      lines.push_back(std::move(mangled));
+    }
+    if (lines.empty())
+      break;
+
+    results.assign(lines.size(), std::string());
+    std::vector<std::thread> workers;
+    for (unsigned workerIdx = 0; workerIdx < numWorkers; ++workerIdx) {
+      workers.emplace_back([&, workerIdx] {
+        // Contexts and regexes are not known to be thread-safe, so each
+        // worker carries its own; lines are sharded round-robin.
+        llvm::Regex maybeSymbol("(_T|_?\\$[Ss])[_a-zA-Z0-9$.]+");
+        swift::Demangle::Context DCtx;
+        for (size_t i = workerIdx, e = lines.size(); i < e; i += numWorkers) {
+          llvm::raw_string_ostream os(results[i]);
+          demangleLine(os, lines[i], maybeSymbol, DCtx, options);
+        }
+      });
+    }
+    for (auto &worker : workers)
+      worker.join();
+
+    for (const std::string &result : results)
+      llvm::outs() << result;
+  }
+
+  return EXIT_SUCCESS;
+}
+
 static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
+  if (NumThreads > 1)
+    return demangleSTDINParallel(options, NumThreads);
+
   // This doesn't handle Unicode symbols, but maybe that's okay.
   // Also accept the future mangling prefix.
   llvm::Regex maybeSymbol("(_T|_?\\$[Ss])[_a-zA-Z0-9$.]+");
 
   swift::Demangle::Context DCtx;
   for (std::string mangled; std::getline(std::cin, mangled);) {
-    llvm::StringRef inputContents(mangled);
-
-    llvm::SmallVector<llvm::StringRef, 1> matches;
-    while (maybeSymbol.match(inputContents, &matches)) {
-      llvm::outs() << substrBefore(inputContents, matches.front());
-      demangle(llvm::outs(), matches.front(), DCtx, options);
-      inputContents = substrAfter(inputContents, matches.front());
-    }
-
-    llvm::outs() << inputContents << '\n';
+    demangleLine(llvm::outs(), mangled, maybeSymbol, DCtx, options);
   }
 
   return EXIT_SUCCESS;
@@ -1103,6 +1103,15 @@ removeCodeCompletionTokens(llvm::MemoryBuffer *Input,
 
 } // namespace
 
+/// Service every completion token in \p SourceFilename from one warm
+/// CompletionInstance, writing per-token results to -completion-output-dir.
+/// This is the batch mode for completion-quality suites: the SDK import
+/// cost is paid once and subsequent tokens reuse the cached ASTContext
+/// whenever CompletionInstance's validity checks allow it. Batching stops
+/// at the file boundary by design — instance reuse requires the same
+/// primary file with changes confined to a function body, so tokens from
+/// different files would rebuild the instance anyway and only share the
+/// on-disk module cache.
 static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
                                  StringRef SourceFilename,
                                  bool CodeCompletionDiagnostics,
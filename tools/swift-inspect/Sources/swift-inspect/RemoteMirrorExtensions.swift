@@ -77,6 +77,22 @@ extension SwiftReflectionContextRef {
     try throwError(str: errStr)
   }
 
+  func iterateAsyncTaskAllocations(
+    task: swift_reflection_ptr_t,
+    _ body: (swift_reflection_ptr_t, Int,
+             UnsafePointer<swift_async_task_allocation_chunk_t>) -> Void
+  ) throws {
+    var body = body
+    let errStr = swift_reflection_iterateAsyncTaskAllocations(self, task, {
+      let callPtr = $3!.bindMemory(to:
+        ((swift_reflection_ptr_t, Int,
+          UnsafePointer<swift_async_task_allocation_chunk_t>) -> Void).self,
+        capacity: 1)
+      callPtr.pointee($0, Int($1), $2!)
+    }, &body)
+    try throwError(str: errStr)
+  }
+
   func metadataPointer(
     allocation: swift_metadata_allocation_t
   ) -> swift_reflection_ptr_t {
@@ -89,6 +89,57 @@ func dumpMetadataCacheNodes(
   }
 }
 
+func dumpMetadataStats(context: SwiftReflectionContextRef) throws {
+  struct TagStats {
+    var count = 0
+    var bytes = 0
+  }
+  var statsByTag: [swift_metadata_allocation_tag_t: TagStats] = [:]
+  for allocation in context.allocations {
+    var stats = statsByTag[allocation.tag] ?? TagStats()
+    stats.count += 1
+    stats.bytes += allocation.size
+    statsByTag[allocation.tag] = stats
+  }
+
+  var totalCount = 0
+  var totalBytes = 0
+  print("Tag","Tag Name","Count","Bytes", separator: "\t")
+  for (tag, stats) in statsByTag.sorted(by: { $0.value.bytes > $1.value.bytes }) {
+    let tagName = context.metadataTagName(tag) ?? "<unknown>"
+    print("\(tag)\t\(tagName)\t\(stats.count)\t\(stats.bytes)")
+    totalCount += stats.count
+    totalBytes += stats.bytes
+  }
+  print("Total:\t\t\(totalCount)\t\(totalBytes)")
+}
+
+func dumpTaskAllocator(
+  context: SwiftReflectionContextRef,
+  taskAddresses: [String]
+) throws {
+  for taskAddress in taskAddresses {
+    let stripped = taskAddress.hasPrefix("0x")
+      ? String(taskAddress.dropFirst(2)) : taskAddress
+    guard let task = swift_reflection_ptr_t(stripped, radix: 16) else {
+      argFail("Invalid task address \(taskAddress)")
+    }
+
+    print("Task \(hex: task) allocator slabs:")
+    var slabCount = 0
+    var usedBytes: UInt64 = 0
+    try context.iterateAsyncTaskAllocations(task: task) { slab, count, chunks in
+      slabCount += 1
+      for i in 0..<count {
+        usedBytes += UInt64(chunks[i].Length)
+        print("  Slab at \(hex: slab): \(chunks[i].Length) bytes in use " +
+              "starting at \(hex: chunks[i].Start)")
+      }
+    }
+    print("  \(slabCount) slab(s), \(usedBytes) bytes in use")
+  }
+}
+
 func printBacktrace(
   style: Backtrace.Style?,
   for ptr: swift_reflection_ptr_t,
@@ -149,6 +200,8 @@ struct SwiftInspect: ParsableCommand {
       DumpRawMetadata.self,
       DumpGenericMetadata.self,
       DumpCacheNodes.self,
+      DumpTaskAllocator.self,
+      MetadataStats.self,
     ])
 }
 
@@ -238,4 +291,35 @@ struct DumpCacheNodes: ParsableCommand {
   }
 }
 
+struct DumpTaskAllocator: ParsableCommand {
+  static let configuration = CommandConfiguration(
+    abstract: "Print the task allocator slab usage of the given async tasks.")
+
+  @OptionGroup()
+  var options: UniversalOptions
+
+  @Argument(help: "Async task addresses to inspect (hex)")
+  var taskAddresses: [String]
+
+  func run() throws {
+    try withReflectionContext(nameOrPid: options.nameOrPid) { context, _ in
+      try dumpTaskAllocator(context: context, taskAddresses: taskAddresses)
+    }
+  }
+}
+
+struct MetadataStats: ParsableCommand {
+  static let configuration = CommandConfiguration(
+    abstract: "Print byte and count totals per metadata allocation tag.")
+
+  @OptionGroup()
+  var options: UniversalOptions
+
+  func run() throws {
+    try withReflectionContext(nameOrPid: options.nameOrPid) { context, _ in
+      try dumpMetadataStats(context: context)
+    }
+  }
+}
+
 SwiftInspect.main()
@@ -624,6 +624,17 @@ static ReflectionContextHolder makeReflectionContextForObjectFiles(
   }
 }
 
+// All images are deliberately processed by one ReflectionContext on one
+// thread. The binaries themselves are already memory-mapped (createBinary
+// reads through MemoryBuffer, which mmaps files of any interesting size),
+// so load cost is page faults over the sections actually touched, not I/O.
+// What cannot be sharded per image is the semantic pass: every image feeds
+// the same TypeRefBuilder so that typerefs resolve across image boundaries,
+// and the builder's interning maps, Demangler, and NodeFactory are
+// single-threaded by design throughout this library. Fan-out belongs one
+// level up — output is grouped per image, so a CI job that wants
+// parallelism can run one process per framework and concatenate, which
+// also isolates a malformed binary's failure to its own invocation.
 static int doDumpReflectionSections(ArrayRef<std::string> BinaryFilenames,
                                     StringRef Arch, ActionType Action,
                                     FILE *file) {
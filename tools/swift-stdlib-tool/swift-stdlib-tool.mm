@@ -803,48 +803,55 @@ copyFile(NSFileManager *fm, NSString *src, NSString *dst, bool stripBitcode)
 }
 
 
-void copyLibraries(NSString *src_dir, NSString *dst_dir, 
+void copyLibraries(NSString *src_dir, NSString *dst_dir,
                    NSMutableDictionary *libs, bool stripBitcode)
 {
-    NSFileManager *fm = NSFileManager.defaultManager;
-
-    [fm createDirectoryAtPath: dst_dir withIntermediateDirectories:YES 
-     attributes:nil error:nil];
-    
-    for (NSString *lib in libs) @autoreleasepool {
-        NSString *src = [src_dir stringByAppendingPathComponent:lib]; 
+    [NSFileManager.defaultManager createDirectoryAtPath: dst_dir
+     withIntermediateDirectories:YES attributes:nil error:nil];
+
+    // Each library copies to its own destination path, so the copies can
+    // proceed concurrently, like the codesign invocations below.
+    [libs enumerateKeysAndObjectsWithOptions: NSEnumerationConcurrent usingBlock: ^(id key, id value, BOOL *stop) {
+      @autoreleasepool {
+        NSString *lib = key;
+        NSString *src = [src_dir stringByAppendingPathComponent:lib];
         NSString *dst = [dst_dir stringByAppendingPathComponent:lib];
-        
+
         // Compare UUIDs of src and dst and don't copy if they're the same.
-        // Do not use mod times for this task: the dst copy gets code-signed 
+        // Do not use mod times for this task: the dst copy gets code-signed
         // and bitcode-stripped so it can look newer than it really is.
-        NSSet *srcUUIDs = libs[lib];
+        NSSet *srcUUIDs = value;
         NSMutableSet *dstUUIDs = [NSMutableSet set];
         process(dst, nil, ^(NSUUID *uuid) {
             [dstUUIDs addObject:uuid];
         });
 
-        log_vv("Source UUIDs %s: %s", src.fileSystemRepresentation, 
+        log_vv("Source UUIDs %s: %s", src.fileSystemRepresentation,
                srcUUIDs.description.UTF8String);
-        log_vv("Destination UUIDs %s: %s", dst.fileSystemRepresentation, 
+        log_vv("Destination UUIDs %s: %s", dst.fileSystemRepresentation,
                dstUUIDs.description.UTF8String);
 
         if ([srcUUIDs isEqualToSet:dstUUIDs]) {
-            log_v("%s is up to date at %s", 
+            log_v("%s is up to date at %s",
                   lib.fileSystemRepresentation, dst.fileSystemRepresentation);
-            continue;
+            return;
         }
-        
+
         // Perform the copy.
-        
-        log_v("Copying %s from %s to %s", 
-              lib.fileSystemRepresentation, 
-              src_dir.fileSystemRepresentation, 
+
+        log_v("Copying %s from %s to %s",
+              lib.fileSystemRepresentation,
+              src_dir.fileSystemRepresentation,
               dst_dir.fileSystemRepresentation);
-        
+
+        // Use a fresh NSFileManager per block, per the thread safety
+        // guidance in its documentation.
+        NSFileManager *fm = [[NSFileManager alloc] init];
         [fm removeItemAtPath:dst error:nil];  // fixme report this err?
         copyFile(fm, src.stringByResolvingSymlinksInPath, dst, stripBitcode);
-    }
+        [fm release];
+      }
+    }];
 }
 
 NSString *relative_path(NSString *base, NSString *suffix_name)
@@ -0,0 +1,124 @@
+//===--- AllocationBudgetTest.cpp -----------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Counter-based cost regression tests. These interpose the global operator
+// new/delete for this test binary and check that key operations stay within a
+// checked-in allocation budget, so that a change that starts copying where it
+// used to borrow fails the build instead of surfacing in profiles a release
+// later. Raw malloc (e.g. demangler node slabs) is not interposed — doing so
+// portably is not possible from a unit test — so the budgets cover C++ heap
+// traffic only.
+//
+// Budgets are deliberately generous upper bounds: they are meant to catch
+// order-of-magnitude behavioral regressions, not to pin exact allocation
+// counts, which vary across C++ standard libraries.
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Demangling/Demangle.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> globalAllocationCount{0};
+static std::atomic<uint64_t> globalAllocatedBytes{0};
+
+static void *countedAlloc(size_t size) {
+  globalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  globalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  void *ptr = malloc(size);
+  // Unittests build with -fno-exceptions, so we cannot throw bad_alloc.
+  if (!ptr)
+    std::abort();
+  return ptr;
+}
+
+void *operator new(size_t size) { return countedAlloc(size); }
+void *operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+namespace {
+
+/// Captures the allocation counters over a scope of interest.
+struct AllocationTally {
+  uint64_t startCount;
+  uint64_t startBytes;
+
+  AllocationTally()
+      : startCount(globalAllocationCount.load(std::memory_order_relaxed)),
+        startBytes(globalAllocatedBytes.load(std::memory_order_relaxed)) {}
+
+  uint64_t allocations() const {
+    return globalAllocationCount.load(std::memory_order_relaxed) - startCount;
+  }
+  uint64_t bytes() const {
+    return globalAllocatedBytes.load(std::memory_order_relaxed) - startBytes;
+  }
+};
+
+} // end anonymous namespace
+
+static const char *const DemangleCorpus[] = {
+    "$ss27_allocateUninitializedArrayySayxG_BptBwlF",
+    "$sSS10FoundationE36_forceBridgeFromObjectiveC_result0eF0ySo8NSStringC_SSSgztFZ",
+    "$s1a1gyq_q__xt_tr0_lF",
+    "$sSo8NSNumberCMa",
+    "$ss12_ArrayBufferV20_consumeAndCreateNew14bufferIsUnique15minimumCapacity13growForAppendAbyxGSb_SiSbtF",
+    "$s4main4SomeCACycfc",
+};
+
+TEST(AllocationBudget, DemanglingCorpusReusingContext) {
+  using namespace swift::Demangle;
+
+  Context Ctx;
+  // Warm up: let the context grow its node slabs to steady state.
+  for (const char *symbol : DemangleCorpus) {
+    (void)Ctx.demangleSymbolAsString(llvm::StringRef(symbol));
+    Ctx.clear();
+  }
+
+  // In steady state, demangling a reused context must not allocate beyond
+  // the output string and the printer's scratch. Budget a handful of
+  // allocations per symbol; a printer that starts building intermediate
+  // strings per node would cost dozens.
+  AllocationTally tally;
+  for (const char *symbol : DemangleCorpus) {
+    std::string result = Ctx.demangleSymbolAsString(llvm::StringRef(symbol));
+    EXPECT_FALSE(result.empty());
+    Ctx.clear();
+  }
+  size_t corpusSize = sizeof(DemangleCorpus) / sizeof(DemangleCorpus[0]);
+  EXPECT_LE(tally.allocations(), corpusSize * 8)
+      << "demangling steady state regressed; is the printer allocating "
+         "per node?";
+  EXPECT_LE(tally.bytes(), corpusSize * 16 * 1024);
+}
+
+TEST(AllocationBudget, DemanglingSingleShotContexts) {
+  using namespace swift::Demangle;
+
+  // A fresh context per symbol pays for the demangler and its first slab
+  // each time. This bounds the cost of the convenience entry points that
+  // cannot reuse a context (e.g. swift_demangle in the runtime).
+  AllocationTally tally;
+  for (const char *symbol : DemangleCorpus) {
+    Context Ctx;
+    std::string result = Ctx.demangleSymbolAsString(llvm::StringRef(symbol));
+    EXPECT_FALSE(result.empty());
+  }
+  size_t corpusSize = sizeof(DemangleCorpus) / sizeof(DemangleCorpus[0]);
+  EXPECT_LE(tally.allocations(), corpusSize * 32);
+}
@@ -13,6 +13,7 @@
 #include "swift/Basic/FileSystem.h"
 #include "swift/Basic/LLVM.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
@@ -270,4 +271,51 @@ TEST(FileSystem, MoveFileIfDifferentInvalid) {
   ASSERT_NO_ERROR(fs::remove(sourceFile, false));
   ASSERT_NO_ERROR(fs::remove(dirPath, false));
 }
+
+TEST(FileSystem, AtomicallyWritingToFileSkipsIdenticalContents) {
+  // Create unique temporary directory for these tests
+  llvm::SmallString<128> dirPath;
+  ASSERT_NO_ERROR(fs::createUniqueDirectory("FileSystem-test", dirPath));
+
+  llvm::SmallString<128> outputFile = dirPath;
+  path::append(outputFile, "output.txt");
+
+  // Test 1: Write a fresh file.
+  ASSERT_NO_ERROR(atomicallyWritingToFile(
+      outputFile, [](llvm::raw_pwrite_stream &out) { out << "contents"; }));
+  ASSERT_TRUE(fs::exists(outputFile));
+
+  fs::UniqueID origID;
+  ASSERT_NO_ERROR(fs::getUniqueID(outputFile, origID));
+
+  // Test 2: Rewriting identical contents must leave the existing file
+  // untouched rather than replacing it.
+  ASSERT_NO_ERROR(atomicallyWritingToFile(
+      outputFile, [](llvm::raw_pwrite_stream &out) { out << "contents"; }));
+
+  fs::UniqueID rewriteID;
+  ASSERT_NO_ERROR(fs::getUniqueID(outputFile, rewriteID));
+  ASSERT_EQ(origID, rewriteID);
+
+  // Test 3: Different contents replace the file.
+  ASSERT_NO_ERROR(atomicallyWritingToFile(
+      outputFile, [](llvm::raw_pwrite_stream &out) { out << "changed"; }));
+
+  auto buffer = llvm::MemoryBuffer::getFile(outputFile);
+  ASSERT_TRUE((bool)buffer);
+  ASSERT_EQ("changed", buffer->get()->getBuffer());
+
+  // No temporaries should be left behind in any case.
+  std::error_code error;
+  unsigned numFiles = 0;
+  for (fs::directory_iterator it(dirPath, error), end; it != end && !error;
+       it.increment(error))
+    ++numFiles;
+  ASSERT_NO_ERROR(error);
+  ASSERT_EQ(1u, numFiles);
+
+  // Clean up.
+  ASSERT_NO_ERROR(fs::remove(outputFile));
+  ASSERT_NO_ERROR(fs::remove(dirPath));
+}
 } // anonymous namespace
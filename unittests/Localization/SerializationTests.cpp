@@ -50,6 +50,36 @@ TEST_F(LocalizationTest, TestYAMLSerialization) {
   });
 }
 
+TEST_F(LocalizationTest, TestLazySerializedOpen) {
+  YAMLLocalizationProducer yaml(YAMLPath);
+
+  auto dbFile = createTemporaryFile("en", "db");
+
+  {
+    SerializedLocalizationWriter writer;
+
+    yaml.forEachAvailable(
+        [&writer](swift::DiagID id, llvm::StringRef translation) {
+          writer.insert(id, translation);
+        });
+
+    ASSERT_FALSE(writer.emit(dbFile));
+  }
+
+  // Construction from a path shouldn't open anything yet, but the first
+  // lookup should see the same content as going through a buffer.
+  SerializedLocalizationProducer db(llvm::StringRef(dbFile));
+  yaml.forEachAvailable([&db](swift::DiagID id, llvm::StringRef translation) {
+    ASSERT_EQ(translation, db.getMessageOr(id, "<no-fallback>"));
+  });
+
+  // A missing file surfaces as the default message, not an error.
+  SerializedLocalizationProducer missing(
+      llvm::StringRef("/nonexistent/path/to/en.db"));
+  ASSERT_EQ("<<<default-fallback>>>",
+            missing.getMessageOr(swift::DiagID(0), "<<<default-fallback>>>"));
+}
+
 TEST_F(LocalizationTest, TestSerializationOfEmptyFile) {
   auto dbFile = createTemporaryFile("by", "db");
   SerializedLocalizationWriter writer;
@@ -0,0 +1,74 @@
+//===--- FailedMatchCacheTests.cpp ----------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Regression tests for the failed concrete-match cache in matchTypes. The
+// cache key has no locator, so pairs whose outcome depends on the locator
+// must never be remembered: these tests fail a locator-dependent match
+// first and then verify the same pair still succeeds where the language
+// allows it.
+//
+//===----------------------------------------------------------------------===//
+
+#include "SemaFixture.h"
+#include "swift/Sema/ConstraintSystem.h"
+
+using namespace swift;
+using namespace swift::unittest;
+using namespace swift::constraints;
+
+TEST_F(SemaTest, FailedMatchCacheDoesNotPoisonTupleSplat) {
+  ConstraintSystem cs(DC, ConstraintSystemOptions());
+
+  auto intType = getStdlibType("Int");
+  auto floatType = getStdlibType("Float");
+
+  // (Int, Int) -> Float vs. ((Int, Int)) -> Float.
+  auto *fn1 = FunctionType::get(
+      {FunctionType::Param(intType), FunctionType::Param(intType)}, floatType);
+  auto tupleType =
+      TupleType::get({TupleTypeElt(intType), TupleTypeElt(intType)}, Context);
+  auto *fn2 = FunctionType::get({FunctionType::Param(tupleType)}, floatType);
+
+  // At a plain locator the tuple parameter cannot be imploded, so the
+  // match fails on the parameter count.
+  auto failed = cs.matchTypes(fn1, fn2, ConstraintKind::Conversion,
+                              ConstraintSystem::TypeMatchOptions(),
+                              cs.getConstraintLocator({}));
+  EXPECT_TRUE(failed.isFailure());
+
+  // The identical pair must still succeed at an apply-argument locator,
+  // where the splat is allowed. A cache that ignored the locator would
+  // replay the failure here.
+  auto succeeded = cs.matchTypes(
+      fn1, fn2, ConstraintKind::Conversion,
+      ConstraintSystem::TypeMatchOptions(),
+      cs.getConstraintLocator(
+          {}, LocatorPathElt::ApplyArgToParam(0, 0, ParameterTypeFlags())));
+  EXPECT_TRUE(succeeded.isSuccess());
+}
+
+TEST_F(SemaTest, FailedMatchCacheStillShortCircuitsPlainPairs) {
+  ConstraintSystem cs(DC, ConstraintSystemOptions());
+
+  auto intType = getStdlibType("Int");
+  auto stringType = getStdlibType("String");
+
+  // A pair with no locator-sensitive paths fails everywhere; repeating
+  // the match (this time served from the cache) must agree.
+  for (unsigned attempt = 0; attempt != 2; ++attempt) {
+    auto result = cs.matchTypes(intType, stringType,
+                                ConstraintKind::Conversion,
+                                ConstraintSystem::TypeMatchOptions(),
+                                cs.getConstraintLocator({}));
+    EXPECT_TRUE(result.isFailure());
+  }
+}